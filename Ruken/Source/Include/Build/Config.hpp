@@ -30,9 +30,73 @@
     #define RUKEN_MULTITHREAD_STATUS_STR "Disabled"
 #endif
 
+// ------------------------------
+//         Task tracing
+
+// Task tracing records every task event of the executive system into per-worker ring buffers.
+// It is opt-in and compiled out entirely unless requested.
+#if defined(RUKEN_REQUEST_TASK_TRACING)
+    #define RUKEN_TASK_TRACING_ENABLED
+    #define RUKEN_TASK_TRACING_STATUS_STR "Enabled"
+#else
+    #define RUKEN_TASK_TRACING_DISABLED
+    #define RUKEN_TASK_TRACING_STATUS_STR "Disabled"
+#endif
+
+// Number of events each worker can record before overwriting the oldest ones. Must be a power of 2.
+#define RUKEN_TASK_TRACING_BUFFER_SIZE 65536
+
+// ------------------------------
+//        Lock profiling
+
+// Lock profiling records acquire counts, wait and hold times of every Synchronized instance (see LockProfiler).
+// It is opt-in and compiled out entirely unless requested.
+#if defined(RUKEN_REQUEST_LOCK_PROFILING)
+    #define RUKEN_LOCK_PROFILING_ENABLED
+    #define RUKEN_LOCK_PROFILING_STATUS_STR "Enabled"
+#else
+    #define RUKEN_LOCK_PROFILING_DISABLED
+    #define RUKEN_LOCK_PROFILING_STATUS_STR "Disabled"
+#endif
+
+// ------------------------------
+//    Executive system scheduling
+
+// Maximum number of continuations a worker can resume in place, through symmetric transfer, before
+// pushing them back to their queue again. This bounds the stack usage when the compiler does not turn
+// symmetric transfers into tail calls and lets other queued jobs run in between. 0 disables symmetric transfer.
+#define RUKEN_CPU_SYMMETRIC_TRANSFER_MAX_DEPTH 64
+
+// Workers serve queues by earliest deadline first. Queues without an explicit deadline get one relative to the last time
+// they were served: (256 - priority) steps of the duration below, in microseconds. This also ages the queues left waiting.
+#define RUKEN_CPU_QUEUE_PRIORITY_STEP_US 100
+
+// Maximum number of rounds (of 10 jobs each) a worker stays on the same queue before the queues are ordered again
+#define RUKEN_CPU_QUEUE_STICKY_ROUNDS 4
+
+// Number of consecutive cycles without any job after which a worker is parked until new jobs are pushed (see CPUParkingLot).
+// Spinning for a few cycles keeps bursts of jobs cheap, parking gives the core back once there is nothing left to run.
+#define RUKEN_CPU_WORKER_IDLE_CYCLES 64
+
+// ------------------------------
+//    Executive system benchmarks
+
+// When requested, the executable runs the executive system benchmark suite instead of the engine,
+// and writes its results as JSON into the file below so that regressions can be tracked.
+#if defined(RUKEN_REQUEST_EXECUTIVE_BENCHMARKS)
+    #define RUKEN_EXECUTIVE_BENCHMARKS_ENABLED
+    #define RUKEN_EXECUTIVE_BENCHMARKS_STATUS_STR "Enabled"
+#else
+    #define RUKEN_EXECUTIVE_BENCHMARKS_DISABLED
+    #define RUKEN_EXECUTIVE_BENCHMARKS_STATUS_STR "Disabled"
+#endif
+
+#define RUKEN_EXECUTIVE_BENCHMARKS_OUTPUT "ExecutiveBenchmarks.json"
+
 // ------------------------------
 //       Resource management
 
+// Resource identifiers are interned 64 bits hashes, their paths are only kept for debug messages (see ResourceIdentifierPool)
 #if defined(RUKEN_CONFIG_DEBUG)
     #define RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
 #endif
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <filesystem>
+
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Measurements of a single benchmark scenario for a given backend and number of workers
+ */
+struct ExecutiveBenchmarkResult
+{
+    std::string scenario         {};    ///< Name of the measured scenario
+    std::string backend          {};    ///< "executive" for the CPU executive system, "legacy" for the scheduler pool
+    RkSize      workers          {0ULL}; ///< Number of threads executing tasks
+    RkSize      samples          {0ULL}; ///< Number of measured rounds
+    RkSize      tasks_per_sample {0ULL}; ///< Number of tasks executed during each round
+    RkDouble    p50_us           {0.0};  ///< Median duration of a round, in microseconds
+    RkDouble    p99_us           {0.0};  ///< 99th percentile duration of a round, in microseconds
+    RkDouble    tasks_per_second {0.0};  ///< Overall task throughput
+};
+
+/**
+ * \brief Benchmark suite of the CPU executive system.
+ *
+ * Every scenario is run against the executive system and against the legacy scheduler pool
+ * (OldWorker threads consuming a ThreadSafeLockQueue), for every thread count from 1 to the requested maximum.
+ *
+ * Scenarios:
+ *  - SpawnLatency   => Round trip of a single empty task, from its creation to the resumption of its awaiter
+ *  - Throughput     => Batch of empty tasks counting down a latch
+ *  - FanOutFanIn    => Batch of small work items counting down a CountDownLatch, awaited by a single task
+ *  - DeepChain      => Chain of tasks, each one awaiting the next one
+ *  - EcsFrame       => Synthetic ECS frame made of sequential phases of parallel systems over chunked entities
+ *
+ * \code
+ * ExecutiveBenchmarks benchmarks {};
+ * benchmarks.Run();
+ * benchmarks.DumpJson("ExecutiveBenchmarks.json");
+ * \endcode
+ *
+ * \note The executive system uses the calling thread as one of its workers, the legacy pool only uses its own threads.
+ */
+class ExecutiveBenchmarks
+{
+    #pragma region Members
+
+    RkSize                                m_max_workers;
+    RkSize                                m_samples;
+    std::vector<ExecutiveBenchmarkResult> m_results {};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    /**
+     * \brief Runs every scenario on the executive system
+     * \param in_workers Total number of threads executing tasks, including the calling thread
+     */
+    RkVoid RunExecutive(RkSize in_workers);
+
+    /**
+     * \brief Runs every scenario on the legacy scheduler pool
+     * \param in_workers Number of threads of the pool
+     */
+    RkVoid RunLegacy(RkSize in_workers);
+
+    #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_max_workers Maximum number of threads to benchmark with, 0 to use the hardware concurrency
+         * \param in_samples Number of measured rounds for each scenario
+         */
+        explicit ExecutiveBenchmarks(RkSize in_max_workers = 0ULL, RkSize in_samples = 200ULL) noexcept;
+
+        ExecutiveBenchmarks(ExecutiveBenchmarks const&) = default;
+        ExecutiveBenchmarks(ExecutiveBenchmarks&&)      = default;
+        ~ExecutiveBenchmarks()                          = default;
+
+        ExecutiveBenchmarks& operator=(ExecutiveBenchmarks const&) = default;
+        ExecutiveBenchmarks& operator=(ExecutiveBenchmarks&&)      = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Runs the whole suite, previous results are discarded
+         */
+        RkVoid Run();
+
+        /**
+         * \brief Returns the results of the last run
+         * \return Results
+         */
+        [[nodiscard]]
+        std::vector<ExecutiveBenchmarkResult> const& GetResults() const noexcept;
+
+        /**
+         * \brief Writes the results of the last run as JSON
+         * \param inout_stream Output stream
+         */
+        RkVoid DumpJson(std::ostream& inout_stream) const;
+
+        /**
+         * \brief Writes the results of the last run as JSON
+         * \param in_path Output file path
+         * \return True if the file could be written, false otherwise
+         */
+        RkBool DumpJson(std::filesystem::path const& in_path) const;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
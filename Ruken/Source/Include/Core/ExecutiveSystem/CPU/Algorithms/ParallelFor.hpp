@@ -0,0 +1,76 @@
+#pragma once
+
+#include <ranges>
+#include <algorithm>
+#include <functional>
+
+#include "Core/ExecutiveSystem/Concepts/QueueHandleType.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CPUDynamicQueue.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUTask.hpp"
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelJoin.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Ranges that can be processed by the parallel algorithms.
+ *        The algorithms store the range as a view, see std::views::all.
+ */
+template <typename TRange>
+concept ParallelRangeType = std::ranges::random_access_range<TRange> && std::ranges::sized_range<TRange> && std::ranges::viewable_range<TRange>;
+
+namespace internal
+{
+    /**
+     * \brief Checks if the passed queue ran out of pending jobs, meaning that some workers might be idling.
+     * \tparam TQueueHandle Queue to check
+     * \return True if no job is pending in the queue, false otherwise
+     */
+    template <QueueHandleType TQueueHandle>
+    [[nodiscard]]
+    RkBool IsQueueStarving() noexcept;
+
+    /**
+     * \brief Processes a range by chunks of grain elements using lazy binary splitting.
+     *        Before each chunk, if the queue is starving, the remaining range is split in half
+     *        and the upper half is pushed as a new part. The part is completed on the join once done.
+     */
+    template <QueueHandleType TQueueHandle, typename TIterator, typename TFunction>
+    RkVoid ParallelForRange(TIterator in_begin, TIterator in_end, RkSize in_grain, TFunction& in_function, ParallelJoin& inout_join) noexcept;
+
+    /**
+     * \brief Task wrapper of ParallelForRange used when splitting
+     */
+    template <QueueHandleType TQueueHandle, typename TIterator, typename TFunction>
+    CPUTask<TQueueHandle> ParallelForPart(TIterator in_begin, TIterator in_end, RkSize in_grain, TFunction& in_function, ParallelJoin& inout_join) noexcept;
+
+    /**
+     * \brief Coroutine behind ParallelFor, the view is kept by value in the frame of the task
+     */
+    template <QueueHandleType TQueueHandle, std::ranges::view TView, typename TFunction>
+    CPUTask<TQueueHandle> ParallelForView(TView in_view, RkSize in_grain, TFunction in_function);
+}
+
+/**
+ * \brief Invokes the passed function on every element of the range, in parallel.
+ *
+ * The calling task processes the range by chunks of `in_grain` elements and only splits the remaining
+ * work in half when the queue runs out of jobs (lazy binary splitting). This keeps the amount of tasks
+ * close to what the workers can actually absorb instead of spawning one task per chunk up front.
+ *
+ * \code
+ * co_await ParallelFor(std::views::iota(0ULL, vertices.size()), 256ULL, [&](RkSize in_index) { ... });
+ * \endcode
+ *
+ * \tparam TQueueHandle Queue the parts are pushed to
+ * \param in_range Range to process. Lvalue ranges are referenced and must stay alive until the completion of the task,
+ *                 rvalue ranges are moved into the task.
+ * \param in_grain Minimum number of elements processed between two split attempts
+ * \param in_function Function invoked on every element of the range
+ * \return Task completing once every element has been processed. Rethrows the first exception raised by the function.
+ */
+template <QueueHandleType TQueueHandle = CPUDynamicQueue, ParallelRangeType TRange, typename TFunction>
+CPUTask<TQueueHandle> ParallelFor(TRange&& in_range, RkSize in_grain, TFunction in_function);
+
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelFor.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitable.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Dynamic join counter used by the parallel algorithms.
+ *
+ * Counts the parts of an algorithm that are still running and completes once all of them are done.
+ * Parts can be forked at any time by any part that has not completed yet.
+ * The first exception raised by any part is kept and rethrown to the awaiter.
+ */
+class ParallelJoin final: public CPUAwaitable<RkVoid, false>
+{
+    #pragma region Members
+
+    std::atomic<RkSize> m_pending {1ULL};
+    std::atomic<RkBool> m_failed  {false};
+
+    #pragma endregion
+
+    protected:
+
+        #pragma region Methods
+
+        RkVoid Deallocate() override
+        {}
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Creates a join with a single running part, the caller.
+         */
+        ParallelJoin()                    = default;
+        ParallelJoin(ParallelJoin const&) = delete;
+        ParallelJoin(ParallelJoin&&)      = delete;
+        ~ParallelJoin() override          = default;
+
+        ParallelJoin& operator=(ParallelJoin const&) = delete;
+        ParallelJoin& operator=(ParallelJoin&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Accounts for a new running part. Must be called by a part that has not completed yet.
+         */
+        RkVoid Fork() noexcept;
+
+        /**
+         * \brief Signals the completion of a part
+         */
+        RkVoid Complete() noexcept;
+
+        /**
+         * \brief Records the passed exception if it is the first one and signals the completion of a part
+         * \param in_reason Exception raised by the part
+         */
+        RkVoid Fail(std::exception_ptr in_reason) noexcept;
+
+        /**
+         * \brief Checks if any part failed. Running parts can use this to return early.
+         * \return True if a part failed, false otherwise
+         */
+        [[nodiscard]]
+        RkBool Failed() const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
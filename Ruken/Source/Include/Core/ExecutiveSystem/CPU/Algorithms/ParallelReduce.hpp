@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <optional>
+
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelFor.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+namespace internal
+{
+    /**
+     * \brief Node of the join tree of a reduction, one node is created per part.
+     *
+     * A node stays pending until its own part and every part forked from it completed.
+     * The part bringing the pending count to zero folds the results of the children into the node
+     * before doing the same with the parent, no lock is ever taken.
+     */
+    template <typename TValue>
+    struct ParallelReduceNode
+    {
+        ParallelReduceNode*                              parent   {nullptr};
+        std::atomic<RkSize>                              pending  {1ULL};
+        std::optional<TValue>                            value    {};
+        std::vector<std::unique_ptr<ParallelReduceNode>> children {}; ///< Only modified by the part owning the node
+    };
+
+    /**
+     * \brief Folds the results of a completed part up the join tree, as far as every part of a subtree completed
+     * \param inout_node Node of the completed part, its value must have been set
+     * \param in_operation Reduction operation
+     */
+    template <typename TValue, typename TOperation>
+    RkVoid ParallelReduceFold(ParallelReduceNode<TValue>* inout_node, TOperation& in_operation);
+
+    /**
+     * \brief Reduces a range by chunks of grain elements using lazy binary splitting.
+     *        Each part accumulates its own partial result in its node before folding it up the join tree.
+     */
+    template <QueueHandleType TQueueHandle, typename TIterator, typename TValue, typename TOperation>
+    RkVoid ParallelReduceRange(TIterator in_begin, TIterator in_end, RkSize in_grain, TOperation& in_operation,
+                               ParallelReduceNode<TValue>& inout_node, ParallelJoin& inout_join) noexcept;
+
+    /**
+     * \brief Task wrapper of ParallelReduceRange used when splitting
+     */
+    template <QueueHandleType TQueueHandle, typename TIterator, typename TValue, typename TOperation>
+    CPUTask<TQueueHandle> ParallelReducePart(TIterator in_begin, TIterator in_end, RkSize in_grain, TOperation& in_operation,
+                                             ParallelReduceNode<TValue>& inout_node, ParallelJoin& inout_join) noexcept;
+
+    /**
+     * \brief Coroutine behind ParallelReduce, the view is kept by value in the frame of the task
+     */
+    template <QueueHandleType TQueueHandle, std::ranges::view TView, typename TValue, typename TOperation>
+    CPUTask<TQueueHandle, TValue> ParallelReduceView(TView in_view, RkSize in_grain, TValue in_init, TOperation in_operation);
+}
+
+/**
+ * \brief Reduces the range using the passed operation, in parallel.
+ *
+ * Similarly to std::reduce, partial results are combined in an unspecified order,
+ * the operation must thus be both associative and commutative.
+ * Splitting follows the same lazy binary splitting strategy as ParallelFor,
+ * partial results are combined along the tree of splits without blocking any worker.
+ *
+ * \tparam TQueueHandle Queue the parts are pushed to
+ * \param in_range Range to reduce. Lvalue ranges are referenced and must stay alive until the completion of the task,
+ *                 rvalue ranges are moved into the task.
+ * \param in_grain Minimum number of elements processed between two split attempts
+ * \param in_init Initial value of the reduction
+ * \param in_operation Binary operation, TValue(TValue, TValue)
+ * \return Task holding the result of the reduction
+ */
+template <QueueHandleType TQueueHandle = CPUDynamicQueue, ParallelRangeType TRange, typename TValue, typename TOperation = std::plus<>>
+CPUTask<TQueueHandle, TValue> ParallelReduce(TRange&& in_range, RkSize in_grain, TValue in_init, TOperation in_operation = {});
+
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelReduce.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+#include <numeric>
+
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelFor.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+namespace internal
+{
+    /**
+     * \brief Coroutine behind ParallelInclusiveScan, the view is kept by value in the frame of the task
+     */
+    template <QueueHandleType TQueueHandle, std::ranges::view TView, std::random_access_iterator TOutputIterator, typename TOperation>
+    CPUTask<TQueueHandle> ParallelInclusiveScanView(TView in_view, TOutputIterator in_output, RkSize in_grain, TOperation in_operation);
+}
+
+/**
+ * \brief Computes the inclusive prefix scan of the range into the output, in parallel.
+ *
+ * The range is cut into blocks of `in_grain` elements. Blocks are first scanned independently,
+ * block offsets are then accumulated sequentially and finally applied to every block in parallel.
+ * The operation must be associative.
+ *
+ * \tparam TQueueHandle Queue the parts are pushed to
+ * \param in_range Range to scan. Lvalue ranges are referenced and must stay alive until the completion of the task,
+ *                 rvalue ranges are moved into the task.
+ * \param in_output Random access iterator to the beginning of the output, may be equal to the beginning of the range
+ * \param in_grain Size of a block
+ * \param in_operation Binary operation, TValue(TValue, TValue)
+ * \return Task completing once the scan is done
+ */
+template <QueueHandleType TQueueHandle = CPUDynamicQueue, ParallelRangeType TRange, std::random_access_iterator TOutputIterator, typename TOperation = std::plus<>>
+CPUTask<TQueueHandle> ParallelInclusiveScan(TRange&& in_range, TOutputIterator in_output, RkSize in_grain, TOperation in_operation = {});
+
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelScan.inl"
+
+END_RUKEN_NAMESPACE
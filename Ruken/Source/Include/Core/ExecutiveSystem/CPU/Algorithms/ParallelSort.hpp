@@ -0,0 +1,45 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelFor.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+namespace internal
+{
+    /**
+     * \brief Sorts both halves of the passed range in parallel before merging them back
+     */
+    template <QueueHandleType TQueueHandle, typename TIterator, typename TCompare>
+    CPUTask<TQueueHandle> ParallelSortPart(TIterator in_begin, TIterator in_end, RkSize in_grain, TCompare& in_compare);
+
+    /**
+     * \brief Coroutine behind ParallelSort, the view is kept by value in the frame of the task
+     */
+    template <QueueHandleType TQueueHandle, std::ranges::view TView, typename TCompare>
+    CPUTask<TQueueHandle> ParallelSortView(TView in_view, RkSize in_grain, TCompare in_compare);
+}
+
+/**
+ * \brief Sorts the range, in parallel, using a merge sort.
+ *
+ * The range is recursively split in halves that are sorted by separate tasks,
+ * until a half is smaller than the grain, in which case it is sorted sequentially.
+ * Both sorted halves are then merged in place. The sort is not stable.
+ *
+ * \tparam TQueueHandle Queue the parts are pushed to
+ * \param in_range Range to sort. Lvalue ranges are referenced and must stay alive until the completion of the task,
+ *                 rvalue ranges are moved into the task.
+ * \param in_grain Size under which a range is sorted sequentially
+ * \param in_compare Comparison function object
+ * \return Task completing once the range is sorted. Rethrows the first exception raised by the comparison.
+ */
+template <QueueHandleType TQueueHandle = CPUDynamicQueue, ParallelRangeType TRange, typename TCompare = std::ranges::less>
+CPUTask<TQueueHandle> ParallelSort(TRange&& in_range, RkSize in_grain, TCompare in_compare = {});
+
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelSort.inl"
+
+END_RUKEN_NAMESPACE
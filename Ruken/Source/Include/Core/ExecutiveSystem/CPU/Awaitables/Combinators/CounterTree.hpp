@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Hierarchical countdown used by the combinators to spread wide fan-ins over multiple counters.
+ *
+ * Children are grouped by packs of `fan_in` under leaf nodes. Once a node has been notified by all of its
+ * children, it forwards a single notification to its parent, and so on until the root awaiter is reached.
+ * This way, no counter ever receives more than `fan_in` notifications, even for fan-ins of tens of thousands of children.
+ */
+class CounterTree
+{
+    public:
+
+        /// Maximum number of children notifying the same counter
+        static constexpr RkSize fan_in {64ULL};
+
+    private:
+
+        struct Node final: CPUAwaiter
+        {
+            std::atomic<RkSize> count  {0ULL};
+            CPUAwaiter*         parent {nullptr};
+
+            /**
+             * \brief Counts down and notifies the parent once every child has been completed
+             */
+            RkVoid OnAwaitedContinuation() noexcept override;
+        };
+
+        #pragma region Members
+
+        std::unique_ptr<Node[]> m_nodes {};
+        CPUAwaiter*             m_root  {nullptr};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        CounterTree()                   = default;
+        CounterTree(CounterTree const&) = delete;
+        CounterTree(CounterTree&&)      = delete;
+        ~CounterTree()                  = default;
+
+        CounterTree& operator=(CounterTree const&) = delete;
+        CounterTree& operator=(CounterTree&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Builds the tree for the passed amount of children.
+         *        Fan-ins smaller than `fan_in` do not require any node nor allocation.
+         * \param in_children_count Number of children that will notify the tree
+         * \param in_root Awaiter notified once per top level node
+         * \return Number of notifications the root will receive once every child has been completed
+         */
+        RkSize Build(RkSize in_children_count, CPUAwaiter& in_root) noexcept;
+
+        /**
+         * \brief Returns the awaiter a given child must notify upon completion
+         * \param in_child_index Index of the child
+         * \return Leaf awaiter
+         */
+        [[nodiscard]]
+        CPUAwaiter& GetLeaf(RkSize in_child_index) const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <memory>
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitable.hpp"
+#include "Core/ExecutiveSystem/CPU/Cancellation/CancellationSource.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUPropagatingContinuation.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Structured group of tasks. Tasks are spawned into the group which is then joined and awaited once.
+ *
+ * Continuations are stored in chunks of `chunk_capacity` elements, the first one being stored in place.
+ * Each chunk counts its own tasks down and only notifies the group once depleted, which forms
+ * a two level counter tree keeping contention low for wide fan-outs.
+ *
+ * If any of the spawned tasks raised an exception, the first one found is rethrown to the awaiter.
+ *
+ * Each group owns a cancellation source, optionally linked to a parent token. Children receive the group token
+ * and are expected to poll or await it. Once the group is both cancelled and joined, the continuations of the
+ * children still running are detached, and the group completes without waiting for them to finish.
+ * Unlinked groups only allocate their cancellation state once a token is requested or the group is cancelled.
+ *
+ * \code
+ * TaskGroup group;
+ * for (auto& chunk: chunks)
+ *     group.Spawn(ProcessChunk(chunk, group.GetToken()));
+ *
+ * co_await group.Join();
+ * \endcode
+ *
+ * \note Spawn() and Join() are not thread safe and are meant to be called by the owner of the group only.
+ * \note A group must be joined and awaited before being destroyed.
+ * \note Detached children keep running until they observe the cancellation, their results are discarded.
+ */
+class TaskGroup final: public CPUAwaiter,
+                       public CPUAwaitable<RkVoid, false>
+{
+    public:
+
+        /// Number of continuations per chunk
+        static constexpr RkSize chunk_capacity {32ULL};
+
+    private:
+
+        /**
+         * \brief Fixed size pack of continuations counting down its own tasks
+         */
+        struct Chunk final: CPUAwaiter
+        {
+            std::array<CPUPropagatingContinuation<RkVoid, false>, chunk_capacity> continuations {};
+
+            std::atomic<RkSize>         pending  {1ULL}; ///< Running tasks, +1 until the chunk is sealed
+            RkSize                      size     {0ULL};
+            TaskGroup*                  group    {nullptr};
+            std::unique_ptr<Chunk>      next     {};
+            std::bitset<chunk_capacity> detached {};     ///< Continuations detached due to a cancellation
+
+            /**
+             * \brief Counts down and notifies the group once the chunk is sealed and every task has been completed
+             */
+            RkVoid OnAwaitedContinuation() noexcept override;
+        };
+
+        /**
+         * \brief Continuation attached to the cancellation state of linked groups
+         */
+        struct CancellationListener final: CPUAwaiter
+        {
+            CPUContinuation continuation {};
+            TaskGroup*      group        {nullptr};
+
+            /**
+             * \brief Marks the group as cancelled and detaches the pending tasks if the group has been joined
+             */
+            RkVoid OnAwaitedContinuation() noexcept override;
+        };
+
+        #pragma region Members
+
+        std::atomic<RkSize>  m_pending;          ///< Unsealed chunks, +1 until the group is joined, +1 for the listener of linked groups
+        RkBool               m_linked;           ///< Linked groups are cancelled through their listener
+        Chunk                m_head      {};
+        Chunk*               m_tail      {&m_head};
+        std::atomic<RkBool>  m_joined    {false};
+        std::atomic<RkBool>  m_cancelled {false};
+        std::atomic<RkBool>  m_detached  {false};
+        CancellationSource   m_source;
+        CancellationListener m_listener  {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Starts listening to the cancellation state of the group
+         */
+        RkVoid Listen() noexcept;
+
+        /**
+         * \brief Marks the group as cancelled and detaches the pending tasks if the group has been joined
+         * \note The caller must hold a count of the group, see DetachPending
+         */
+        RkVoid OnCancelled() noexcept;
+
+        /**
+         * \brief Detaches the continuations of every task still running and counts them down on their behalf.
+         *        Only the first call has any effect.
+         * \note The caller must hold a count of the group, otherwise the group could complete during the pass
+         */
+        RkVoid DetachPending() noexcept;
+
+        #pragma endregion
+
+    protected:
+
+        #pragma region Methods
+
+        RkVoid Deallocate() override
+        {}
+
+        #pragma endregion
+
+    public:
+
+        using ProcessingUnit = CentralProcessingUnit;
+
+        #pragma region Lifetime
+
+        TaskGroup() noexcept;
+
+        /**
+         * \brief Linked group constructor
+         * \param in_parent Parent token, cancelling it will cancel the group as well
+         */
+        explicit TaskGroup(CancellationToken const& in_parent) noexcept;
+
+        TaskGroup(TaskGroup const&) = delete;
+        TaskGroup(TaskGroup&&)      = delete;
+        ~TaskGroup() override       = default;
+
+        TaskGroup& operator=(TaskGroup const&) = delete;
+        TaskGroup& operator=(TaskGroup&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Adds a task to the group. The group keeps a reference onto the task until destroyed.
+         * \param in_task Task to add
+         * \warning Spawning tasks into a joined group is undefined behavior
+         */
+        RkVoid Spawn(CPUAwaitableHandle<RkVoid, false> const& in_task) noexcept;
+
+        /**
+         * \brief Seals the group. The group completes once every spawned task has been completed.
+         * \return Reference onto the group so it can be directly awaited
+         */
+        [[nodiscard]]
+        TaskGroup& Join() noexcept;
+
+        /**
+         * \brief Requests the cancellation of the group, propagated to every task observing the group token
+         */
+        RkVoid RequestCancellation() noexcept;
+
+        /**
+         * \brief Returns a token observing the cancellation of the group, meant to be passed to the spawned tasks
+         * \return Cancellation token
+         */
+        [[nodiscard]]
+        CancellationToken GetToken() const noexcept;
+
+        /**
+         * \brief Called when the last task of a chunk has been completed
+         */
+        RkVoid OnAwaitedContinuation() noexcept override;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <ranges>
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitable.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuation.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/CounterTree.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Awaitable completing once every awaitable of the passed range has been completed.
+ *
+ * Up to `inline_capacity` continuations are stored in place, making small fan-ins allocation-free.
+ * Bigger ranges allocate their continuations once and rely on a CounterTree so that completions
+ * do not all contend on the same counter.
+ *
+ * \note The awaited handles must outlive the WhenAll instance.
+ *       Results and exceptions are not propagated and can be read back from the handles upon completion.
+ */
+class WhenAll final: public CPUAwaiter,
+                     public CPUAwaitable<RkVoid, true>
+{
+    public:
+
+        /// Number of continuations stored in place
+        static constexpr RkSize inline_capacity {16ULL};
+
+    private:
+
+        #pragma region Members
+
+        std::atomic<RkSize>                          m_count                {0ULL};
+        CounterTree                                  m_tree                 {};
+        std::array<CPUContinuation, inline_capacity> m_inline_continuations {};
+        std::unique_ptr<CPUContinuation[]>           m_continuations        {};
+
+        #pragma endregion
+
+    protected:
+
+        #pragma region Methods
+
+        RkVoid Deallocate() override
+        {}
+
+        #pragma endregion
+
+    public:
+
+        using ProcessingUnit = CentralProcessingUnit;
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Attaches a continuation to every awaitable of the range
+         * \tparam TRange Sized range of CPUAwaitableHandle (or CPUTask)
+         * \param in_handles Handles to await
+         */
+        template <std::ranges::sized_range TRange>
+        explicit WhenAll(TRange const& in_handles) noexcept;
+
+        WhenAll(WhenAll const&) = delete;
+        WhenAll(WhenAll&&)      = delete;
+        ~WhenAll() override     = default;
+
+        WhenAll& operator=(WhenAll const&) = delete;
+        WhenAll& operator=(WhenAll&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Called when an awaited event (or a node of the counter tree) has been completed
+         */
+        RkVoid OnAwaitedContinuation() noexcept override;
+
+        #pragma endregion
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/WhenAll.inl"
+
+END_RUKEN_NAMESPACE
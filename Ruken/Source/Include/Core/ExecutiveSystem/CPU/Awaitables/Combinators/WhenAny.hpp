@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <ranges>
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitable.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuation.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Awaitable completing as soon as one of the awaitables of the passed range has been completed.
+ *        The result of the awaitable is the index of the first completed awaitable.
+ *
+ * Up to `inline_capacity` arms are stored in place, making small ranges allocation-free.
+ * Remaining arms are detached upon destruction so that late completions never reach a destroyed instance.
+ *
+ * \note The awaited handles must outlive the WhenAny instance.
+ */
+class WhenAny final: public CPUAwaitable<RkSize, true>
+{
+    public:
+
+        /// Number of arms stored in place
+        static constexpr RkSize inline_capacity {8ULL};
+
+        /// Result of the awaitable when the passed range is empty
+        static constexpr RkSize none {std::numeric_limits<RkSize>::max()};
+
+    private:
+
+        /**
+         * \brief Continuation awaiting a single awaitable of the range
+         */
+        struct Arm final: CPUAwaiter
+        {
+            CPUContinuation     continuation {};
+            WhenAny*            owner        {nullptr};
+            RkSize              index        {0ULL};
+            std::atomic<RkBool> notified     {false};
+
+            /**
+             * \brief Attempts to complete the owner with the index of the arm
+             */
+            RkVoid OnAwaitedContinuation() noexcept override;
+        };
+
+        #pragma region Members
+
+        std::atomic<RkBool>              m_completed   {false};
+        std::array<Arm, inline_capacity> m_inline_arms {};
+        std::unique_ptr<Arm[]>           m_heap_arms   {};
+        Arm*                             m_arms        {nullptr};
+        RkSize                           m_arm_count   {0ULL};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Completes the awaitable if no other arm did it first
+         * \param in_index Index of the completed awaitable
+         */
+        RkVoid Complete(RkSize in_index) noexcept;
+
+        #pragma endregion
+
+    protected:
+
+        #pragma region Methods
+
+        RkVoid Deallocate() override
+        {}
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Attaches an arm to every awaitable of the range
+         * \tparam TRange Sized range of CPUAwaitableHandle (or CPUTask)
+         * \param in_handles Handles to await
+         */
+        template <std::ranges::sized_range TRange>
+        explicit WhenAny(TRange const& in_handles) noexcept;
+
+        WhenAny(WhenAny const&) = delete;
+        WhenAny(WhenAny&&)      = delete;
+        ~WhenAny() noexcept override;
+
+        WhenAny& operator=(WhenAny const&) = delete;
+        WhenAny& operator=(WhenAny&&)      = delete;
+
+        #pragma endregion
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/WhenAny.inl"
+
+END_RUKEN_NAMESPACE
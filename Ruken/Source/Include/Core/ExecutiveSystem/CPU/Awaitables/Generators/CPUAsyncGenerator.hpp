@@ -0,0 +1,263 @@
+#pragma once
+
+#include <utility>
+#include <optional>
+#include <exception>
+#include <coroutine>
+
+#include "Build/Config.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/Concepts/QueueHandleType.hpp"
+#include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUQueuedPromise.hpp"
+#include "Core/ExecutiveSystem/CPU/Tracing/TaskTracer.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Asynchronous generator, lazily streaming the values produced by a coroutine to a single consumer task.
+ *
+ * The producer only runs when the consumer asks for the next value and suspends at every co_yield,
+ * at most one value is in flight at any time. The producer can await any CPU event in between values.
+ *
+ * \code
+ * CPUAsyncGenerator<IOQueue, std::string> ReadLines(File& in_file)
+ * {
+ *     while (std::optional<Chunk> chunk {co_await in_file.ReadChunk()})
+ *         for (std::string& line: SplitLines(*chunk))
+ *             co_yield std::move(line);
+ * }
+ *
+ * CPUTask<GameplayQueue> Load(File& in_file)
+ * {
+ *     CPUAsyncGenerator<IOQueue, std::string> lines {ReadLines(in_file)};
+ *
+ *     while (std::optional<std::string> line {co_await lines.Next()})
+ *         Parse(*line);
+ * }
+ * \endcode
+ *
+ * The producer runs on the queue TQueueHandle, the consumer stays on its own queue.
+ * Using CPUDynamicQueue makes the producer run on the queue of the consumer instead,
+ * as it stood when the value has been awaited.
+ * When both are on the same queue, values are handed over through symmetric transfer without going through the queue.
+ *
+ * Exceptions raised by the producer are rethrown by the awaiter of the next value, the generator is then completed.
+ *
+ * \tparam TQueueHandle Queue the producer is executed on
+ * \tparam TType Type of the produced values
+ * \warning The generator must not be destroyed while a value is being awaited, and values must be awaited by one task at a time
+ */
+template <QueueHandleType TQueueHandle, typename TType>
+class CPUAsyncGenerator
+{
+    public:
+
+        class NextAwaiter;
+
+        /**
+         * \brief Promise of the producer coroutine
+         */
+        class promise_type final: public CPUQueuedPromise<promise_type, TQueueHandle>
+        {
+            friend CPUAsyncGenerator;
+            friend NextAwaiter;
+            friend CPUQueuedPromise<promise_type, TQueueHandle>;
+
+            #pragma region Members
+
+            std::optional<TType>    m_value     {};
+            std::exception_ptr      m_exception {};
+            CPUAwaiter*             m_consumer  {nullptr};
+            CentralProcessingQueue* m_queue     {nullptr}; ///< Queue of the producer, resolved when the value is awaited
+            RkBool                  m_done      {false};
+
+            #pragma endregion
+
+            #pragma region Methods
+
+            /**
+             * \brief Returns the queue the producer runs on until the value is handed over
+             * \note TQueueHandle is resolved from the consumer, the completion of an awaited event
+             *       could otherwise send a dynamic producer to the queue of the notifying worker.
+             * \return Queue instance
+             */
+            [[nodiscard]]
+            CentralProcessingQueue& GetQueue() const noexcept
+            { return *m_queue; }
+
+            /**
+             * \brief Hands the last produced value, or the completion, over to the consumer
+             * \return Handle to resume in place, the consumer itself if it can be claimed
+             */
+            std::coroutine_handle<> HandOver() noexcept;
+
+            #pragma endregion
+
+            public:
+
+                using ProcessingUnit = CentralProcessingUnit;
+
+                /**
+                 * \brief Suspends the producer and resumes the consumer
+                 */
+                struct HandOverAwaiter: std::suspend_always
+                {
+                    promise_type& self;
+
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<>) const noexcept
+                    { return self.HandOver(); }
+                };
+
+                #pragma region Lifetime
+
+                promise_type()                    = default;
+                promise_type(promise_type const&) = delete;
+                promise_type(promise_type&&     ) = delete;
+                ~promise_type() override          = default;
+
+                promise_type& operator=(promise_type const&) = delete;
+                promise_type& operator=(promise_type&&     ) = delete;
+
+                #pragma endregion
+
+                #pragma region Methods
+
+                /// ----- Coroutine methods -----
+                ///
+
+                CPUAsyncGenerator get_return_object() noexcept
+                { return CPUAsyncGenerator {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+
+                // Generators are lazy, nothing is produced until the first value is awaited
+                std::suspend_always initial_suspend() const noexcept
+                { return {}; }
+
+                HandOverAwaiter final_suspend() noexcept;
+
+                /**
+                 * \brief Stores the produced value and hands it over to the consumer
+                 * \param in_value Produced value
+                 * \return Awaiter suspending the producer until the next value is awaited
+                 */
+                HandOverAwaiter yield_value(TType in_value) noexcept(std::is_nothrow_move_constructible_v<TType>);
+
+                RkVoid return_void() const noexcept
+                {}
+
+                RkVoid unhandled_exception() noexcept
+                { m_exception = std::current_exception(); }
+
+                #pragma endregion
+        };
+
+        /**
+         * \brief Awaiter resuming the producer until it yields its next value
+         */
+        class NextAwaiter
+        {
+            #pragma region Members
+
+            CPUAsyncGenerator& m_generator;
+
+            #pragma endregion
+
+            public:
+
+                using ProcessingUnit = CentralProcessingUnit;
+
+                #pragma region Lifetime
+
+                /**
+                 * \brief Default constructor
+                 * \param in_generator Generator to pull the next value from
+                 */
+                explicit NextAwaiter(CPUAsyncGenerator& in_generator) noexcept;
+
+                NextAwaiter(NextAwaiter const&) = default;
+                NextAwaiter(NextAwaiter&&     ) = default;
+                ~NextAwaiter()                  = default;
+
+                NextAwaiter& operator=(NextAwaiter const&) = delete;
+                NextAwaiter& operator=(NextAwaiter&&     ) = delete;
+
+                #pragma endregion
+
+                #pragma region Methods
+
+                /**
+                 * \brief Checks if the producer completed already
+                 * \return True if there is nothing left to produce, false otherwise
+                 */
+                [[nodiscard]]
+                RkBool await_ready() const noexcept;
+
+                /**
+                 * \brief Resumes the producer, the awaiting task is resumed once the next value has been produced
+                 * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+                 * \param in_handle Handle of the awaiting task
+                 * \return Handle to resume in place, the producer itself if it runs on the current queue
+                 */
+                template <typename TPromise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept;
+
+                /**
+                 * \brief Returns the produced value, rethrows the exception raised by the producer if any
+                 * \return Produced value, or an empty optional once the producer completed
+                 */
+                std::optional<TType> await_resume() const;
+
+                #pragma endregion
+        };
+
+    private:
+
+        #pragma region Members
+
+        std::coroutine_handle<promise_type> m_handle;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_handle Handle of the producer coroutine
+         */
+        explicit CPUAsyncGenerator(std::coroutine_handle<promise_type> in_handle) noexcept;
+
+        CPUAsyncGenerator(CPUAsyncGenerator const&) = delete;
+        CPUAsyncGenerator(CPUAsyncGenerator&& in_move) noexcept;
+        ~CPUAsyncGenerator() noexcept;
+
+        CPUAsyncGenerator& operator=(CPUAsyncGenerator const&) = delete;
+        CPUAsyncGenerator& operator=(CPUAsyncGenerator&& in_move) noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Awaits the next value of the generator
+         * \return Awaiter, returning an empty optional once the producer completed
+         */
+        [[nodiscard]]
+        NextAwaiter Next() noexcept;
+
+        /**
+         * \brief Checks if the producer completed
+         * \return True if there is nothing left to produce, false otherwise
+         * \warning This cannot be called while a value is being awaited
+         */
+        [[nodiscard]]
+        RkBool Done() const noexcept;
+
+        #pragma endregion
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Generators/CPUAsyncGenerator.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include <filesystem>
+
+#include "Core/ExecutiveSystem/CPU/IO/CPUIORequest.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Asynchronously reads a whole file, executed by the I/O service.
+ *        Awaiting this returns true if the file has been entirely read, false otherwise.
+ *
+ * \note The buffer is resized to the size of the file and must stay alive until the read completes.
+ *       The read fails if the buffer cannot be allocated.
+ */
+class AsyncReadFile final: public CPUIORequest
+{
+    #pragma region Members
+
+    std::filesystem::path m_path;
+    std::vector<RkByte>&  m_buffer;
+    RkBool                m_result {false};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    RkVoid Execute() noexcept override;
+
+    #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_path Path of the file to read
+         * \param out_buffer Buffer receiving the content of the file
+         */
+        AsyncReadFile(std::filesystem::path in_path, std::vector<RkByte>& out_buffer) noexcept;
+
+        ~AsyncReadFile() override = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the result of the read
+         * \return True if the file has been entirely read, false otherwise
+         */
+        [[nodiscard]]
+        RkBool await_resume() const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
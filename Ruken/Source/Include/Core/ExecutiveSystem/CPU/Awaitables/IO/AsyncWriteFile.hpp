@@ -0,0 +1,60 @@
+#pragma once
+
+#include <span>
+#include <filesystem>
+
+#include "Core/ExecutiveSystem/CPU/IO/CPUIORequest.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Asynchronously writes a whole file, executed by the I/O service.
+ *        The file is created or truncated before being written.
+ *        Awaiting this returns true if the data has been entirely written, false otherwise.
+ *
+ * \note The data must stay alive until the write completes.
+ */
+class AsyncWriteFile final: public CPUIORequest
+{
+    #pragma region Members
+
+    std::filesystem::path   m_path;
+    std::span<RkByte const> m_data;
+    RkBool                  m_result {false};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    RkVoid Execute() noexcept override;
+
+    #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_path Path of the file to write
+         * \param in_data Data to write
+         */
+        AsyncWriteFile(std::filesystem::path in_path, std::span<RkByte const> in_data) noexcept;
+
+        ~AsyncWriteFile() override = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the result of the write
+         * \return True if the data has been entirely written, false otherwise
+         */
+        [[nodiscard]]
+        RkBool await_resume() const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
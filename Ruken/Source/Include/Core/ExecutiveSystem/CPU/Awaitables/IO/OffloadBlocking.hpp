@@ -0,0 +1,81 @@
+#pragma once
+
+#include <utility>
+#include <variant>
+#include <optional>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <type_traits>
+
+#include "Core/ExecutiveSystem/CPU/IO/CPUIORequest.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Executes a blocking function on the blocking thread pool (see CPUIOService), without stalling any CPU worker.
+ *        Awaiting this returns the result of the function, exceptions are rethrown in the awaiting task.
+ *
+ * \code
+ * CPUTask<ResourceQueue> LoadPixels(std::filesystem::path const& in_path)
+ * {
+ *     Pixels pixels {co_await OffloadBlocking([&] { return stbi_load(in_path.string().c_str(), ...); })};
+ *     ...
+ * }
+ * \endcode
+ *
+ * \tparam TFunction Function type, invoked without any argument
+ * \note The awaiting task is resumed on its own queue, anything captured by reference stays alive until then.
+ */
+template <std::invocable TFunction>
+class OffloadBlocking final: public CPUIORequest
+{
+    using Result = std::invoke_result_t<TFunction&>;
+
+    static_assert(!std::is_reference_v<Result>, "Blocking functions must return their result by value");
+
+    #pragma region Members
+
+    TFunction                                                                         m_function;
+    std::conditional_t<std::is_void_v<Result>, std::monostate, std::optional<Result>> m_result    {};
+    std::exception_ptr                                                                m_exception {};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    RkVoid Execute() noexcept override;
+
+    #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_function Blocking function to execute
+         */
+        explicit OffloadBlocking(TFunction in_function) noexcept(std::is_nothrow_move_constructible_v<TFunction>);
+
+        ~OffloadBlocking() override = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the result of the function, rethrows its exception if any
+         * \return Result of the function
+         */
+        Result await_resume();
+
+        #pragma endregion
+};
+
+template <typename TFunction>
+OffloadBlocking(TFunction) -> OffloadBlocking<TFunction>;
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/IO/OffloadBlocking.inl"
+
+END_RUKEN_NAMESPACE
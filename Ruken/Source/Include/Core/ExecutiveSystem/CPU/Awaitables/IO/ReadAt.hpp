@@ -0,0 +1,61 @@
+#pragma once
+
+#include <span>
+
+#include "Core/ExecutiveSystem/CPU/IO/FileHandle.hpp"
+#include "Core/ExecutiveSystem/CPU/IO/CPUIORequest.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Asynchronous positional read, executed by the I/O service.
+ *        Awaiting this returns the number of bytes read.
+ *
+ * \note The file and the buffer must stay alive until the read completes.
+ */
+class ReadAt final: public CPUIORequest
+{
+    #pragma region Members
+
+    FileHandle const& m_file;
+    RkSize            m_offset;
+    std::span<RkByte> m_buffer;
+    RkSize            m_result {0ULL};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    RkVoid Execute() noexcept override;
+
+    #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_file File to read from
+         * \param in_offset Offset in bytes from the beginning of the file
+         * \param out_buffer Buffer to fill
+         */
+        ReadAt(FileHandle const& in_file, RkSize in_offset, std::span<RkByte> out_buffer) noexcept;
+
+        ~ReadAt() override = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the result of the read
+         * \return Number of bytes read
+         */
+        [[nodiscard]]
+        RkSize await_resume() const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
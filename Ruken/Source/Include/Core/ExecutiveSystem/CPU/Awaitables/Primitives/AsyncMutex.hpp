@@ -0,0 +1,187 @@
+#pragma once
+
+#include <coroutine>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuation.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncScopedLock.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Asynchronous mutual exclusion primitive.
+ *
+ * Tasks failing to acquire the mutex are suspended instead of blocking their worker.
+ * Once unlocked, the mutex is directly handed over to the next waiting task, in arrival order,
+ * which is then pushed back to its own queue.
+ *
+ * \code
+ * {
+ *     AsyncMutexLock const lock {co_await mutex.ScopedLock()};
+ *
+ *     // Critical section
+ * }
+ * \endcode
+ *
+ * \note Unlike std::mutex, the mutex is not owned by a thread and can be unlocked from any worker
+ * \warning The mutex must be unlocked when destroyed
+ */
+class AsyncMutex
+{
+    #pragma region Members
+
+    // consumed => unlocked, nullptr => locked without any waiter,
+    // any other value => locked, head of the waiters attached since the last unlock (last in first out)
+    CPUContinuation::Node m_state   {CPUContinuation::consumed};
+    CPUContinuation*      m_waiters {nullptr}; ///< Waiters in arrival order, only accessed by the owner of the mutex
+
+    #pragma endregion
+
+    public:
+
+        /**
+         * \brief Awaiter acquiring the mutex
+         */
+        class LockAwaiter
+        {
+            #pragma region Members
+
+            AsyncMutex&     m_mutex;
+            CPUContinuation m_continuation {};
+
+            #pragma endregion
+
+            #pragma region Methods
+
+            /**
+             * \brief Acquires the mutex or attaches the awaiting task to the waiters of the mutex
+             * \param inout_owner Awaiting task
+             * \return True if the task has been suspended, false if the mutex has been acquired
+             */
+            RkBool Suspend(CPUAwaiter& inout_owner) noexcept;
+
+            #pragma endregion
+
+            public:
+
+                using ProcessingUnit = CentralProcessingUnit;
+
+                #pragma region Lifetime
+
+                /**
+                 * \brief Default constructor
+                 * \param in_mutex Mutex to acquire
+                 */
+                explicit LockAwaiter(AsyncMutex& in_mutex) noexcept;
+
+                LockAwaiter(LockAwaiter const&) = default;
+                ~LockAwaiter()                  = default;
+
+                LockAwaiter& operator=(LockAwaiter const&) = delete;
+                LockAwaiter& operator=(LockAwaiter&&     ) = delete;
+
+                #pragma endregion
+
+                #pragma region Methods
+
+                /**
+                 * \brief Attempts to acquire the mutex without suspending
+                 * \return True if the mutex has been acquired, false otherwise
+                 */
+                [[nodiscard]]
+                RkBool await_ready() const noexcept;
+
+                /**
+                 * \brief Acquires the mutex or suspends the awaiting task until the mutex is handed over to it
+                 * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+                 * \param in_handle Handle of the awaiting task
+                 * \return True if the task has been suspended, false if the mutex has been acquired
+                 */
+                template <typename TPromise>
+                RkBool await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept;
+
+                RkVoid await_resume() const noexcept
+                {}
+
+                #pragma endregion
+
+            protected:
+
+                #pragma region Methods
+
+                /**
+                 * \brief Returns the awaited mutex
+                 * \return Mutex
+                 */
+                [[nodiscard]]
+                AsyncMutex& GetMutex() const noexcept;
+
+                #pragma endregion
+        };
+
+        class ScopedLockAwaiter;
+
+        #pragma region Lifetime
+
+        AsyncMutex()                  = default;
+        AsyncMutex(AsyncMutex const&) = delete;
+        AsyncMutex(AsyncMutex&&     ) = delete;
+        ~AsyncMutex()                 = default;
+
+        AsyncMutex& operator=(AsyncMutex const&) = delete;
+        AsyncMutex& operator=(AsyncMutex&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Attempts to acquire the mutex without suspending
+         * \return True if the mutex has been acquired, false otherwise
+         */
+        [[nodiscard]]
+        RkBool TryLock() noexcept;
+
+        /**
+         * \brief Acquires the mutex, the awaiting task is suspended until the mutex is available
+         * \return Awaiter
+         */
+        [[nodiscard]]
+        LockAwaiter Lock() noexcept;
+
+        /**
+         * \brief Acquires the mutex, the awaiting task is suspended until the mutex is available.
+         *        The awaiter returns a lock releasing the mutex once going out of scope.
+         * \return Awaiter
+         */
+        [[nodiscard]]
+        ScopedLockAwaiter ScopedLock() noexcept;
+
+        /**
+         * \brief Unlocks the mutex, or hands it over to the next waiting task
+         * \warning The mutex must have been acquired first
+         */
+        RkVoid Unlock() noexcept;
+
+        #pragma endregion
+};
+
+using AsyncMutexLock = AsyncScopedLock<AsyncMutex, &AsyncMutex::Unlock>;
+
+/**
+ * \brief Awaiter acquiring the mutex and returning a lock owning it
+ */
+class AsyncMutex::ScopedLockAwaiter final: public AsyncMutex::LockAwaiter
+{
+    public:
+
+        using LockAwaiter::LockAwaiter;
+
+        [[nodiscard]]
+        AsyncMutexLock await_resume() const noexcept;
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncMutex.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <utility>
+
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Owns an acquired asynchronous primitive (see AsyncMutex, AsyncSharedMutex and AsyncSemaphore)
+ *        and releases it when going out of scope
+ * \tparam TLockable Primitive type
+ * \tparam TRelease Method of the primitive releasing it
+ */
+template <typename TLockable, RkVoid (TLockable::*TRelease)() noexcept>
+class AsyncScopedLock
+{
+    #pragma region Members
+
+    TLockable* m_lockable;
+
+    #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_lockable Already acquired primitive
+         */
+        explicit AsyncScopedLock(TLockable& in_lockable) noexcept:
+            m_lockable {std::addressof(in_lockable)}
+        {}
+
+        AsyncScopedLock(AsyncScopedLock const&) = delete;
+        AsyncScopedLock(AsyncScopedLock&& in_move) noexcept:
+            m_lockable {std::exchange(in_move.m_lockable, nullptr)}
+        {}
+
+        ~AsyncScopedLock() noexcept
+        { Release(); }
+
+        AsyncScopedLock& operator=(AsyncScopedLock const&) = delete;
+        AsyncScopedLock& operator=(AsyncScopedLock&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Releases the primitive before the end of the scope, does nothing if it has already been released
+         */
+        RkVoid Release() noexcept
+        {
+            if (m_lockable)
+                (std::exchange(m_lockable, nullptr)->*TRelease)();
+        }
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
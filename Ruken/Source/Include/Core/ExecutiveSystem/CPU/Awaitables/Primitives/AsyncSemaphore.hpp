@@ -0,0 +1,222 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuation.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuationQueue.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncScopedLock.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Asynchronous counting semaphore, typically used to bound the number of concurrent operations.
+ *
+ * Tasks failing to acquire a permit are suspended instead of blocking their worker.
+ * Released permits are directly handed over to the waiting tasks, in arrival order,
+ * which are then pushed back to their own queue.
+ *
+ * \code
+ * AsyncSemaphore uploads {4ULL};
+ *
+ * CPUTask<UploadQueue> Upload(Resource& in_resource)
+ * {
+ *     AsyncSemaphorePermit const permit {co_await uploads.ScopedAcquire()};
+ *
+ *     // At most 4 uploads are running at any time
+ * }
+ * \endcode
+ *
+ * \warning No task must be waiting for a permit when the semaphore is destroyed
+ */
+class AsyncSemaphore
+{
+    #pragma region Members
+
+    std::atomic<RkSize>  m_count;
+    std::atomic_flag     m_guard   {}; ///< Protects the waiters, only held for a few instructions
+    CPUContinuationQueue m_waiters {};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    /**
+     * \brief Acquires the guard of the waiters
+     */
+    RkVoid LockWaiters() noexcept;
+
+    /**
+     * \brief Releases the guard of the waiters
+     */
+    RkVoid UnlockWaiters() noexcept;
+
+    #pragma endregion
+
+    public:
+
+        /**
+         * \brief Awaiter acquiring a permit of the semaphore
+         */
+        class AcquireAwaiter
+        {
+            #pragma region Members
+
+            AsyncSemaphore& m_semaphore;
+            CPUContinuation m_continuation {};
+
+            #pragma endregion
+
+            #pragma region Methods
+
+            /**
+             * \brief Acquires a permit or appends the awaiting task to the waiters of the semaphore
+             * \param inout_owner Awaiting task
+             * \return True if the task has been suspended, false if a permit has been acquired
+             */
+            RkBool Suspend(CPUAwaiter& inout_owner) noexcept;
+
+            #pragma endregion
+
+            public:
+
+                using ProcessingUnit = CentralProcessingUnit;
+
+                #pragma region Lifetime
+
+                /**
+                 * \brief Default constructor
+                 * \param in_semaphore Semaphore to acquire a permit of
+                 */
+                explicit AcquireAwaiter(AsyncSemaphore& in_semaphore) noexcept;
+
+                AcquireAwaiter(AcquireAwaiter const&) = default;
+                ~AcquireAwaiter()                     = default;
+
+                AcquireAwaiter& operator=(AcquireAwaiter const&) = delete;
+                AcquireAwaiter& operator=(AcquireAwaiter&&     ) = delete;
+
+                #pragma endregion
+
+                #pragma region Methods
+
+                /**
+                 * \brief Attempts to acquire a permit without suspending
+                 * \return True if a permit has been acquired, false otherwise
+                 */
+                [[nodiscard]]
+                RkBool await_ready() const noexcept;
+
+                /**
+                 * \brief Acquires a permit or suspends the awaiting task until a permit is handed over to it
+                 * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+                 * \param in_handle Handle of the awaiting task
+                 * \return True if the task has been suspended, false if a permit has been acquired
+                 */
+                template <typename TPromise>
+                RkBool await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept;
+
+                RkVoid await_resume() const noexcept
+                {}
+
+                #pragma endregion
+
+            protected:
+
+                #pragma region Methods
+
+                /**
+                 * \brief Returns the awaited semaphore
+                 * \return Semaphore
+                 */
+                [[nodiscard]]
+                AsyncSemaphore& GetSemaphore() const noexcept;
+
+                #pragma endregion
+        };
+
+        class ScopedAcquireAwaiter;
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_initial_count Initial number of available permits
+         */
+        explicit AsyncSemaphore(RkSize in_initial_count) noexcept;
+
+        AsyncSemaphore(AsyncSemaphore const&) = delete;
+        AsyncSemaphore(AsyncSemaphore&&     ) = delete;
+        ~AsyncSemaphore()                     = default;
+
+        AsyncSemaphore& operator=(AsyncSemaphore const&) = delete;
+        AsyncSemaphore& operator=(AsyncSemaphore&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Attempts to acquire a permit without suspending
+         * \return True if a permit has been acquired, false otherwise
+         */
+        [[nodiscard]]
+        RkBool TryAcquire() noexcept;
+
+        /**
+         * \brief Acquires a permit, the awaiting task is suspended until a permit is available
+         * \return Awaiter
+         */
+        [[nodiscard]]
+        AcquireAwaiter Acquire() noexcept;
+
+        /**
+         * \brief Acquires a permit, the awaiting task is suspended until a permit is available.
+         *        The awaiter returns a permit releasing itself once going out of scope.
+         * \return Awaiter
+         */
+        [[nodiscard]]
+        ScopedAcquireAwaiter ScopedAcquire() noexcept;
+
+        /**
+         * \brief Releases a single permit
+         */
+        RkVoid Release() noexcept;
+
+        /**
+         * \brief Releases permits, waiting tasks are resumed first
+         * \param in_count Number of permits to release
+         */
+        RkVoid Release(RkSize in_count) noexcept;
+
+        /**
+         * \brief Returns the number of available permits
+         * \warning Synchronization cannot be achieved with this function.
+         * \return Available permits
+         */
+        [[nodiscard]]
+        RkSize GetAvailableCount() const noexcept;
+
+        #pragma endregion
+};
+
+using AsyncSemaphorePermit = AsyncScopedLock<AsyncSemaphore, &AsyncSemaphore::Release>;
+
+/**
+ * \brief Awaiter acquiring a permit of the semaphore and returning it as a scoped object
+ */
+class AsyncSemaphore::ScopedAcquireAwaiter final: public AsyncSemaphore::AcquireAwaiter
+{
+    public:
+
+        using AcquireAwaiter::AcquireAwaiter;
+
+        [[nodiscard]]
+        AsyncSemaphorePermit await_resume() const noexcept;
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncSemaphore.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuation.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuationQueue.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncScopedLock.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Asynchronous readers-writer mutex.
+ *
+ * Tasks failing to acquire the mutex are suspended instead of blocking their worker,
+ * and are pushed back to their own queue once the mutex is handed over to them.
+ *
+ * To avoid starving any side, new readers wait as soon as a writer is waiting,
+ * and releasing an exclusive lock resumes every waiting reader before the next writer.
+ *
+ * \code
+ * {
+ *     AsyncSharedMutexReadLock const lock {co_await mutex.ScopedLockShared()};
+ *
+ *     // Shared section
+ * }
+ * \endcode
+ *
+ * \warning The mutex must be unlocked when destroyed
+ */
+class AsyncSharedMutex
+{
+    #pragma region Members
+
+    std::atomic_flag     m_guard           {}; ///< Protects the state of the mutex, only held for a few instructions
+    RkSize               m_readers         {0ULL};
+    RkBool               m_writer          {false};
+    CPUContinuationQueue m_waiting_readers {};
+    CPUContinuationQueue m_waiting_writers {};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    /**
+     * \brief Acquires the guard of the mutex state
+     */
+    RkVoid LockState() noexcept;
+
+    /**
+     * \brief Releases the guard of the mutex state
+     */
+    RkVoid UnlockState() noexcept;
+
+    /**
+     * \brief Acquires the mutex if possible, the guard of the state must be held
+     * \param in_shared True to acquire a shared lock, false for an exclusive one
+     * \return True if the mutex has been acquired, false otherwise
+     */
+    RkBool TryLockUnsafe(RkBool in_shared) noexcept;
+
+    #pragma endregion
+
+    public:
+
+        /**
+         * \brief Awaiter acquiring the mutex, either in shared or in exclusive mode
+         */
+        class LockAwaiter
+        {
+            #pragma region Members
+
+            AsyncSharedMutex& m_mutex;
+            CPUContinuation   m_continuation {};
+            RkBool            m_shared;
+
+            #pragma endregion
+
+            #pragma region Methods
+
+            /**
+             * \brief Acquires the mutex or appends the awaiting task to the waiters of the mutex
+             * \param inout_owner Awaiting task
+             * \return True if the task has been suspended, false if the mutex has been acquired
+             */
+            RkBool Suspend(CPUAwaiter& inout_owner) noexcept;
+
+            #pragma endregion
+
+            public:
+
+                using ProcessingUnit = CentralProcessingUnit;
+
+                #pragma region Lifetime
+
+                /**
+                 * \brief Default constructor
+                 * \param in_mutex Mutex to acquire
+                 * \param in_shared True to acquire a shared lock, false for an exclusive one
+                 */
+                LockAwaiter(AsyncSharedMutex& in_mutex, RkBool in_shared) noexcept;
+
+                LockAwaiter(LockAwaiter const&) = default;
+                ~LockAwaiter()                  = default;
+
+                LockAwaiter& operator=(LockAwaiter const&) = delete;
+                LockAwaiter& operator=(LockAwaiter&&     ) = delete;
+
+                #pragma endregion
+
+                #pragma region Methods
+
+                /**
+                 * \brief Attempts to acquire the mutex without suspending
+                 * \return True if the mutex has been acquired, false otherwise
+                 */
+                [[nodiscard]]
+                RkBool await_ready() const noexcept;
+
+                /**
+                 * \brief Acquires the mutex or suspends the awaiting task until the mutex is handed over to it
+                 * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+                 * \param in_handle Handle of the awaiting task
+                 * \return True if the task has been suspended, false if the mutex has been acquired
+                 */
+                template <typename TPromise>
+                RkBool await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept;
+
+                RkVoid await_resume() const noexcept
+                {}
+
+                #pragma endregion
+
+            protected:
+
+                #pragma region Methods
+
+                /**
+                 * \brief Returns the awaited mutex
+                 * \return Mutex
+                 */
+                [[nodiscard]]
+                AsyncSharedMutex& GetMutex() const noexcept;
+
+                #pragma endregion
+        };
+
+        class ScopedLockAwaiter;
+        class ScopedLockSharedAwaiter;
+
+        #pragma region Lifetime
+
+        AsyncSharedMutex()                        = default;
+        AsyncSharedMutex(AsyncSharedMutex const&) = delete;
+        AsyncSharedMutex(AsyncSharedMutex&&     ) = delete;
+        ~AsyncSharedMutex()                       = default;
+
+        AsyncSharedMutex& operator=(AsyncSharedMutex const&) = delete;
+        AsyncSharedMutex& operator=(AsyncSharedMutex&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Attempts to acquire an exclusive lock without suspending
+         * \return True if the mutex has been acquired, false otherwise
+         */
+        [[nodiscard]]
+        RkBool TryLock() noexcept;
+
+        /**
+         * \brief Attempts to acquire a shared lock without suspending
+         * \return True if the mutex has been acquired, false otherwise
+         */
+        [[nodiscard]]
+        RkBool TryLockShared() noexcept;
+
+        /**
+         * \brief Acquires an exclusive lock, the awaiting task is suspended until the mutex is available
+         * \return Awaiter
+         */
+        [[nodiscard]]
+        LockAwaiter Lock() noexcept;
+
+        /**
+         * \brief Acquires a shared lock, the awaiting task is suspended until the mutex is available
+         * \return Awaiter
+         */
+        [[nodiscard]]
+        LockAwaiter LockShared() noexcept;
+
+        /**
+         * \brief Acquires an exclusive lock, the awaiting task is suspended until the mutex is available.
+         *        The awaiter returns a lock releasing the mutex once going out of scope.
+         * \return Awaiter
+         */
+        [[nodiscard]]
+        ScopedLockAwaiter ScopedLock() noexcept;
+
+        /**
+         * \brief Acquires a shared lock, the awaiting task is suspended until the mutex is available.
+         *        The awaiter returns a lock releasing the mutex once going out of scope.
+         * \return Awaiter
+         */
+        [[nodiscard]]
+        ScopedLockSharedAwaiter ScopedLockShared() noexcept;
+
+        /**
+         * \brief Releases an exclusive lock, waiting readers are resumed first, then the next waiting writer
+         * \warning An exclusive lock must have been acquired first
+         */
+        RkVoid Unlock() noexcept;
+
+        /**
+         * \brief Releases a shared lock, the next waiting writer is resumed once there is no reader left
+         * \warning A shared lock must have been acquired first
+         */
+        RkVoid UnlockShared() noexcept;
+
+        #pragma endregion
+};
+
+using AsyncSharedMutexWriteLock = AsyncScopedLock<AsyncSharedMutex, &AsyncSharedMutex::Unlock>;
+using AsyncSharedMutexReadLock  = AsyncScopedLock<AsyncSharedMutex, &AsyncSharedMutex::UnlockShared>;
+
+/**
+ * \brief Awaiter acquiring an exclusive lock and returning a lock owning it
+ */
+class AsyncSharedMutex::ScopedLockAwaiter final: public AsyncSharedMutex::LockAwaiter
+{
+    public:
+
+        explicit ScopedLockAwaiter(AsyncSharedMutex& in_mutex) noexcept;
+
+        [[nodiscard]]
+        AsyncSharedMutexWriteLock await_resume() const noexcept;
+};
+
+/**
+ * \brief Awaiter acquiring a shared lock and returning a lock owning it
+ */
+class AsyncSharedMutex::ScopedLockSharedAwaiter final: public AsyncSharedMutex::LockAwaiter
+{
+    public:
+
+        explicit ScopedLockSharedAwaiter(AsyncSharedMutex& in_mutex) noexcept;
+
+        [[nodiscard]]
+        AsyncSharedMutexReadLock await_resume() const noexcept;
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncSharedMutex.inl"
+
+END_RUKEN_NAMESPACE
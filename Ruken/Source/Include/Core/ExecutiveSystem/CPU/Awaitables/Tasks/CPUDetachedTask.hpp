@@ -0,0 +1,120 @@
+#pragma once
+
+#include <utility>
+#include <exception>
+#include <coroutine>
+
+#include "Build/Config.hpp"
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/Concepts/QueueHandleType.hpp"
+#include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CPUSpawnBatch.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUQueuedPromise.hpp"
+#include "Core/ExecutiveSystem/CPU/Tracing/TaskTracer.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Fire and forget CPU task.
+ *
+ * Unlike CPUTask, a detached task cannot be awaited: it holds no result, no reference count and no continuation list,
+ * and its frame is destroyed as soon as it completes. This is meant for one shot background work
+ * (garbage collection passes, log flushes...) where nobody is interested in the completion.
+ *
+ * \code
+ * CPUDetachedTask<BackgroundQueue> Compact(Cache& inout_cache)
+ * {
+ *     inout_cache.Compact();
+ *     co_return;
+ * }
+ *
+ * Compact(cache); // Pushed to the background queue right away, nothing to keep around
+ * \endcode
+ *
+ * Detached tasks can still await any CPU event, and are deferred by CPUSpawnBatch like regular tasks.
+ *
+ * \tparam TQueueHandle Queue the task is executed on
+ * \warning Nothing can observe an exception escaping a detached task, the program is terminated instead
+ */
+template <QueueHandleType TQueueHandle>
+struct CPUDetachedTask
+{
+    using ProcessingUnit = typename TQueueHandle::ProcessingUnit;
+
+    /**
+     * \brief Promise of a detached task
+     */
+    class promise_type final: public CPUQueuedPromise<promise_type, TQueueHandle>
+    {
+        public:
+
+            using ProcessingUnit = CentralProcessingUnit;
+
+            #pragma region Lifetime
+
+            promise_type()                    = default;
+            promise_type(promise_type const&) = delete;
+            promise_type(promise_type&&     ) = delete;
+            ~promise_type() override          = default;
+
+            promise_type& operator=(promise_type const&) = delete;
+            promise_type& operator=(promise_type&&     ) = delete;
+
+            #pragma endregion
+
+            #pragma region Methods
+
+            /// ----- Coroutine methods -----
+            ///
+
+            CPUDetachedTask get_return_object() noexcept
+            {
+                RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Spawn,
+                    std::coroutine_handle<promise_type>::from_promise(*this).address(), &TQueueHandle::GetInstance());
+
+                return {};
+            }
+
+            auto initial_suspend() const noexcept
+            {
+                struct Awaiter: std::suspend_always
+                {
+                    // The task is only pushed once suspended, otherwise another worker
+                    // could resume the coroutine before it even reached its initial suspension point.
+                    void await_suspend(std::coroutine_handle<promise_type> in_handle) const noexcept
+                    {
+                        if (WorkerInfo::spawn_batch)
+                        {
+                            WorkerInfo::spawn_batch->Defer(TQueueHandle::GetInstance(), in_handle);
+                            return;
+                        }
+
+                        TQueueHandle::GetInstance().Push(in_handle);
+                    }
+                };
+
+                return Awaiter {};
+            }
+
+            // Nobody holds a reference to the task, the frame is destroyed right away
+            std::suspend_never final_suspend() noexcept
+            {
+                RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Complete,
+                    std::coroutine_handle<promise_type>::from_promise(*this).address(), &TQueueHandle::GetInstance());
+
+                return {};
+            }
+
+            RkVoid return_void() const noexcept
+            {}
+
+            [[noreturn]]
+            RkVoid unhandled_exception() const noexcept
+            { std::terminate(); }
+
+            #pragma endregion
+    };
+};
+
+END_RUKEN_NAMESPACE
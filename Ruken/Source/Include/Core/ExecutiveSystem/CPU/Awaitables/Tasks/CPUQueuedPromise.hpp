@@ -0,0 +1,128 @@
+#pragma once
+
+#include <utility>
+#include <coroutine>
+#include <type_traits>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/Concepts/AwaitableType.hpp"
+#include "Core/ExecutiveSystem/Concepts/QueueHandleType.hpp"
+#include "Core/ExecutiveSystem/Concepts/DirectAwaiterType.hpp"
+#include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitableHandle.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CentralProcessingQueue.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUCoroutineContinuation.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Behavior shared by the promises of every coroutine executed on a CPU queue (tasks, detached tasks, generators).
+ *
+ * Converts the awaited types to asynchronous events, and sends the coroutine back to its queue
+ * once the awaited event completed. The queue is TQueueHandle's instance unless the inheriting promise
+ * hides GetQueue with its own.
+ *
+ * \tparam TPromise Inheriting promise type (CRTP)
+ * \tparam TQueueHandle Queue the coroutine is executed on
+ */
+template <typename TPromise, QueueHandleType TQueueHandle>
+class CPUQueuedPromise: public CPUAwaiter
+{
+    protected:
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the queue the coroutine is resumed on
+         * \return Queue instance
+         */
+        [[nodiscard]]
+        CentralProcessingQueue& GetQueue() const noexcept
+        { return TQueueHandle::GetInstance(); }
+
+        /**
+         * \brief Called by the awaited event upon completion
+         * This method pushes the coroutine back to its queue for execution,
+         * unless the completing task can resume it in place (see CPUTaskPromise::final_suspend).
+         */
+        RkVoid OnAwaitedContinuation() noexcept override
+        {
+            std::coroutine_handle<TPromise> const handle {std::coroutine_handle<TPromise>::from_promise(static_cast<TPromise&>(*this))};
+            CentralProcessingQueue&               queue  {static_cast<TPromise&>(*this).GetQueue()};
+
+            // The first continuation released by a task completing on the same queue is claimed by that task,
+            // saving a round trip through the queue and keeping the coroutine on the current worker.
+            if (WorkerInfo::transfer_allowed && WorkerInfo::current_queue == &queue)
+            {
+                WorkerInfo::transfer_allowed      = false;
+                WorkerInfo::transfer_continuation = handle;
+                return;
+            }
+
+            // CPU coroutines are not processed in place and are instead pushed to a queue
+            // to be picked up and processed by a worker later.
+            queue.Push(handle);
+        }
+
+        #pragma endregion
+
+    public:
+
+        using ProcessingUnit = CentralProcessingUnit;
+
+        #pragma region Lifetime
+
+        CPUQueuedPromise()                        = default;
+        CPUQueuedPromise(CPUQueuedPromise const&) = default;
+        CPUQueuedPromise(CPUQueuedPromise&&     ) = default;
+        ~CPUQueuedPromise() override              = default;
+
+        CPUQueuedPromise& operator=(CPUQueuedPromise const&) = default;
+        CPUQueuedPromise& operator=(CPUQueuedPromise&&     ) = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /// ----- Coroutine methods -----
+        ///
+
+        /**
+         * \brief Converts awaited types to asynchronous events if possible
+         * \tparam TAwaitable Event type
+         * \param in_awaitable Asynchronous event instance
+         * \return Subscription instance
+         */
+        template <AwaitableType TAwaitable>
+        auto await_transform(TAwaitable&& in_awaitable) noexcept
+        {
+            using AResult              = typename std::decay_t<TAwaitable>::Result;
+            using AProcessingUnit      = typename std::decay_t<TAwaitable>::ProcessingUnit;
+            constexpr bool is_noexcept =          std::decay_t<TAwaitable>::reliable;
+            static_assert(std::is_same_v<AProcessingUnit, CentralProcessingUnit>,
+                "Awaiting events from other processing units is not yet supported");
+
+            // In the case we don't need a bridge, we know the awaitable inherits from CPUAwaitable
+            if constexpr(std::is_base_of_v<CPUAwaitableHandle<AResult>, TAwaitable>)
+                return CPUCoroutineContinuation<AResult, is_noexcept> (*this, std::forward<TAwaitable>(in_awaitable));
+            else
+                return CPUCoroutineContinuation<AResult, is_noexcept> (*this, CPUAwaitableHandle<AResult, is_noexcept>(in_awaitable));
+        }
+
+        /**
+         * \brief Direct awaiters do not need any conversion and are awaited in place
+         * \note Temporary awaiters live until the end of the co_await expression, returning a reference is safe
+         * \tparam TAwaiter Awaiter type
+         * \param in_awaiter Awaiter instance
+         * \return Awaiter instance
+         */
+        template <DirectAwaiterType<CentralProcessingUnit> TAwaiter>
+        std::remove_reference_t<TAwaiter>& await_transform(TAwaiter&& in_awaiter) noexcept
+        { return in_awaiter; }
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <utility>
+
+#include "Build/Config.hpp"
 #include "Build/Namespace.hpp"
-#include "Core/ExecutiveSystem/Concepts/AwaitableType.hpp"
+#include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CPUSpawnBatch.hpp"
 #include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitable.hpp"
-#include "Core/ExecutiveSystem/CPU/Continuations/CPUCoroutineContinuation.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUQueuedPromise.hpp"
+#include "Core/ExecutiveSystem/CPU/Tracing/TaskTracer.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
@@ -17,24 +22,13 @@ struct CPUTask;
 template <QueueHandleType TQueueHandle, typename TResult>
 class CPUTaskPromise final:
     public CPUAwaitable<TResult, false>,
-    public CPUAwaiter
+    public CPUQueuedPromise<CPUTaskPromise<TQueueHandle, TResult>, TQueueHandle>
 {
     template <typename TOtherResult>
     friend class CPUPromise;
 
 	#pragma region Methods
 
-    /**
-     * \brief Called by the awaited event upon completion
-     * This method simply pushes the coroutine back to the queue for execution.
-     */
-    RkVoid OnAwaitedContinuation() noexcept override
-    {
-        // CPU Tasks are not processed in place and are instead pushed to a queue
-        // to be picked up and processed by a worker later.
-        TQueueHandle::GetInstance().Push(std::coroutine_handle<CPUTaskPromise>::from_promise(*this));
-    }
-
     /**
      * \brief Destroys the coroutine frame when there is no longer any references made to it.
      */
@@ -67,7 +61,7 @@ class CPUTaskPromise final:
         ///
 
         /**
-         * \brief Constructs, queues up and returns a handle to the promise
+         * \brief Constructs and returns a handle to the promise
          * \return Promise handle
          */
         CPUTask<TQueueHandle, TResult> get_return_object() noexcept
@@ -77,51 +71,72 @@ class CPUTaskPromise final:
             // has time to be incremented to 1 before the task is executed and deleted by another thread
             CPUTask<TQueueHandle, TResult> handle {*this};
 
-            // CPU Tasks are not processed in place and are instead pushed to a queue
-            // to be picked up and processed by a worker later.
-            TQueueHandle::GetInstance().Push(std::coroutine_handle<CPUTaskPromise>::from_promise(*this));
+            RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Spawn,
+                std::coroutine_handle<CPUTaskPromise>::from_promise(*this).address(), &TQueueHandle::GetInstance());
 
             return handle;
         }
 
-        /**
-         * \brief Converts awaited types to asynchronous events if possible
-         * \tparam TAwaitable Event type
-         * \param in_awaitable Asynchronous event instance
-         * \return Subscription instance
-         */
-        template <AwaitableType TAwaitable>
-        auto await_transform(TAwaitable&& in_awaitable) noexcept
-        {
-            using AResult              = typename std::decay_t<TAwaitable>::Result;
-            using AProcessingUnit      = typename std::decay_t<TAwaitable>::ProcessingUnit;
-            constexpr bool is_noexcept =          std::decay_t<TAwaitable>::reliable;
-            static_assert(std::is_same_v<AProcessingUnit, CentralProcessingUnit>, 
-                "Awaiting events from other processing units is not yet supported");
-
-            // In the case we don't need a bridge, we know the awaitable inherits from CPUAwaitable
-            if constexpr(std::is_base_of_v<CPUAwaitableHandle<AResult>, TAwaitable>)
-                return CPUCoroutineContinuation<AResult, is_noexcept> (*this, std::forward<TAwaitable>(in_awaitable));
-            else
-                return CPUCoroutineContinuation<AResult, is_noexcept> (*this, CPUAwaitableHandle<AResult, is_noexcept>(in_awaitable));
-        }
-
         // CPU tasks will never start synchronously and are instead inserted into queues for it to be eventually processed.
         // Final suspension depends on the number of references that are made to the coroutine.
         // Since we have to hold a result, the promise cannot be destroyed if there are still references to it
         // in that case, the last reference to be removed will destroy the coroutine.
         // If no references are made to the coroutine at the time of completion, the destruction happens immediately.
-        auto initial_suspend() noexcept { return std::suspend_always {}; }
+        auto initial_suspend() noexcept
+        {
+            struct Awaiter: std::suspend_always
+            {
+                // The task is only pushed once suspended, otherwise another worker
+                // could resume the coroutine before it even reached its initial suspension point.
+                void await_suspend(std::coroutine_handle<CPUTaskPromise> in_handle) const noexcept
+                {
+                    // Tasks spawned within a batch are pushed all at once when the batch is submitted
+                    if (WorkerInfo::spawn_batch)
+                    {
+                        WorkerInfo::spawn_batch->Defer(TQueueHandle::GetInstance(), in_handle);
+                        return;
+                    }
+
+                    // CPU Tasks are not processed in place and are instead pushed to a queue
+                    // to be picked up and processed by a worker later.
+                    TQueueHandle::GetInstance().Push(in_handle);
+                }
+            };
+
+            return Awaiter {};
+        }
+
         auto final_suspend  () noexcept
         {
             struct Awaiter: std::suspend_always
             {
                 CPUTaskPromise& self;
 
-                void await_suspend(std::coroutine_handle<>) const noexcept
+                // Symmetric transfer: the first continuation of the same queue is resumed in place by returning its handle,
+                // the remaining ones are pushed as usual. Chains are bounded by RUKEN_CPU_SYMMETRIC_TRANSFER_MAX_DEPTH
+                // to keep the stack in check and to let other queued jobs run in between.
+                std::coroutine_handle<> await_suspend([[maybe_unused]] std::coroutine_handle<> in_handle) const noexcept
                 {
+                    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Complete, in_handle.address(), &TQueueHandle::GetInstance());
+
+                    WorkerInfo::transfer_allowed = WorkerInfo::transfer_depth < RUKEN_CPU_SYMMETRIC_TRANSFER_MAX_DEPTH;
+
 					self.SignalConsume();
+
+                    // Destroying the frame might run arbitrary destructors, nothing can be claimed past this point
+                    WorkerInfo::transfer_allowed = false;
+
                     self.DecrementReferenceCount();
+
+                    std::coroutine_handle<> const continuation {std::exchange(WorkerInfo::transfer_continuation, nullptr)};
+                    if (!continuation)
+                        return std::noop_coroutine();
+
+                    ++WorkerInfo::transfer_depth;
+
+                    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Transfer, continuation.address(), &TQueueHandle::GetInstance());
+
+                    return continuation;
                 }
             };
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+
+#include "Types/Units/Duration/Duration.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Timers/Until.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Suspends the awaiting task for the passed duration, without blocking any worker.
+ *        The task is then pushed back to its own queue.
+ *
+ * \note Any duration unit (Milliseconds, Seconds, Minutes) is accepted as they all convert to Milliseconds.
+ *       Negative durations do not suspend the task.
+ */
+class Delay final: public Until
+{
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_duration Duration to wait for
+         */
+        explicit Delay(Milliseconds in_duration) noexcept;
+
+        /**
+         * \brief Standard duration constructor
+         * \param in_duration Duration to wait for
+         */
+        template <typename TRep, typename TPeriod>
+        explicit Delay(std::chrono::duration<TRep, TPeriod> in_duration) noexcept;
+
+        Delay(Delay const&) = default;
+        Delay(Delay&&     ) = default;
+        ~Delay()            = default;
+
+        Delay& operator=(Delay const&) = default;
+        Delay& operator=(Delay&&     ) = default;
+
+        #pragma endregion
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Timers/Delay.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <coroutine>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Timers/CPUTimer.hpp"
+#include "Core/ExecutiveSystem/CPU/Timers/CPUTimerWheel.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Suspends the awaiting task until the passed time point has been reached, without blocking any worker.
+ *        The task is then pushed back to its own queue.
+ *
+ * \note The precision of the wait depends on how often workers service the timer wheel (see CPUTimerWheel).
+ *       The task is never resumed before the time point.
+ */
+class Until
+{
+    #pragma region Members
+
+    CPUTimer                 m_timer      {};
+    CPUTimerWheel::TimePoint m_time_point {};
+
+    #pragma endregion
+
+    public:
+
+        using ProcessingUnit = CentralProcessingUnit;
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_time_point Time point to wait for
+         */
+        explicit Until(CPUTimerWheel::TimePoint in_time_point) noexcept;
+
+        Until(Until const&) = default;
+        Until(Until&&     ) = default;
+        ~Until()            = default;
+
+        Until& operator=(Until const&) = default;
+        Until& operator=(Until&&     ) = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Checks if the time point has already been reached
+         * \return True if the time point has been reached, false otherwise
+         */
+        [[nodiscard]]
+        RkBool await_ready() const noexcept;
+
+        /**
+         * \brief Arms the timer of the awaiter, the promise of the task will be notified once it expires
+         * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+         * \param in_handle Handle of the suspended task
+         */
+        template <typename TPromise>
+        RkVoid await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept;
+
+        RkVoid await_resume() const noexcept
+        {}
+
+        #pragma endregion
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Timers/Until.inl"
+
+END_RUKEN_NAMESPACE
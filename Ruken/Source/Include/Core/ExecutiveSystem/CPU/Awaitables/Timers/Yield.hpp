@@ -0,0 +1,68 @@
+#pragma once
+
+#include <coroutine>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Suspends the awaiting task and pushes it back at the end of its own queue.
+ *
+ * Long running tasks should yield at safe points, this lets the jobs queued meanwhile run first
+ * and lets time budgeted workers (see CentralProcessingUnit::CallerAsWorker) return without overshooting their deadline.
+ *
+ * \code
+ * for (Chunk& chunk: chunks)
+ * {
+ *     Bake(chunk);
+ *     co_await Yield();
+ * }
+ * \endcode
+ */
+class Yield
+{
+    public:
+
+        using ProcessingUnit = CentralProcessingUnit;
+
+        #pragma region Lifetime
+
+        Yield()             = default;
+        Yield(Yield const&) = default;
+        Yield(Yield&&     ) = default;
+        ~Yield()            = default;
+
+        Yield& operator=(Yield const&) = default;
+        Yield& operator=(Yield&&     ) = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Yielding always suspends the task
+         * \return False
+         */
+        [[nodiscard]]
+        RkBool await_ready() const noexcept
+        { return false; }
+
+        /**
+         * \brief Pushes the task back to its queue
+         * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+         * \param in_handle Handle of the suspended task
+         */
+        template <typename TPromise>
+        RkVoid await_suspend(std::coroutine_handle<TPromise> in_handle) const noexcept;
+
+        RkVoid await_resume() const noexcept
+        {}
+
+        #pragma endregion
+};
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Timers/Yield.inl"
+
+END_RUKEN_NAMESPACE
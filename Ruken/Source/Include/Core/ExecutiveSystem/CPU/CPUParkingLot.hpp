@@ -0,0 +1,83 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <stop_token>
+#include <condition_variable>
+
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class CentralProcessingQueue;
+
+/**
+ * \brief Place where the threads of the central processing unit sleep while there is nothing to run.
+ *
+ * Idle workers park themselves instead of spinning over empty queues. Every push onto a CentralProcessingQueue
+ * notifies the lot, which only costs a fence and a load while no thread is parked.
+ * Parked threads are woken up in time to service the timer wheel, see CPUTimerWheel::GetNextExpiry.
+ */
+class CPUParkingLot
+{
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+    private:
+
+        #pragma region Members
+
+        std::atomic<RkSize>         m_parked       {0ULL};
+        std::mutex                  m_mutex        {};
+        std::condition_variable_any m_notification {};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        CPUParkingLot()                     = default;
+        CPUParkingLot(CPUParkingLot const&) = delete;
+        CPUParkingLot(CPUParkingLot&&     ) = delete;
+        ~CPUParkingLot()                    = default;
+
+        CPUParkingLot& operator=(CPUParkingLot const&) = delete;
+        CPUParkingLot& operator=(CPUParkingLot&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the parking lot instance
+         * \return Parking lot instance
+         */
+        static CPUParkingLot& GetInstance() noexcept;
+
+        /**
+         * \brief Parks the calling thread until a job is pushed onto one of the passed queues, the next timer expires,
+         *        the passed counter reaches 0 or a stop is requested.
+         * \param in_queues Queues the calling thread is processing
+         * \param in_stop_token Stop token, parking is interrupted as soon as a stop is requested
+         * \param in_counter Optional counter, parking is interrupted once it reaches 0. See Notify.
+         * \param in_deadline The thread is woken up at this time point at the latest
+         */
+        RkVoid Park(std::vector<CentralProcessingQueue*> const& in_queues,
+                    std::stop_token                      const& in_stop_token,
+                    std::atomic<RkSize>                  const* in_counter  = nullptr,
+                    Clock::time_point                           in_deadline = Clock::time_point::max()) noexcept;
+
+        /**
+         * \brief Wakes the parked threads up so that they check their wake up conditions again.
+         *        This must be called after any change that can satisfy these conditions.
+         */
+        RkVoid Notify() noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Cancellation/CancellationToken.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Issues cancellation requests to every token it handed out.
+ *
+ * Sources can be linked to a parent token, in which case the cancellation
+ * of the parent is automatically propagated to the source and all of its tokens.
+ *
+ * The shared state of an unlinked source is only allocated once a token is requested or the cancellation is requested,
+ * sources that are never observed nor cancelled do not allocate anything.
+ *
+ * \code
+ * CancellationSource level_loading;
+ * for (auto const& asset: assets)
+ *     LoadAsset(asset, level_loading.GetToken());
+ *
+ * // Later on, when the level unloads
+ * level_loading.RequestCancellation();
+ * \endcode
+ */
+class CancellationSource
+{
+    #pragma region Members
+
+    mutable std::atomic<internal::CancellationState*> m_state;
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    /**
+     * \brief Returns the state of the source, allocating it on first use
+     * \return Cancellation state
+     */
+    [[nodiscard]]
+    internal::CancellationState& GetState() const noexcept;
+
+    #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor, does not allocate anything
+         */
+        CancellationSource() noexcept;
+
+        /**
+         * \brief Linked source constructor
+         * \param in_parent Parent token, cancelling it will cancel this source as well.
+         *        If the token cannot be cancelled, the source is not linked.
+         */
+        explicit CancellationSource(CancellationToken const& in_parent) noexcept;
+
+        CancellationSource(CancellationSource const&) = delete;
+        CancellationSource(CancellationSource&&)      = delete;
+        ~CancellationSource() noexcept;
+
+        CancellationSource& operator=(CancellationSource const&) = delete;
+        CancellationSource& operator=(CancellationSource&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Requests the cancellation of every token of this source as well as every linked source.
+         *        Only the first request has any effect.
+         */
+        RkVoid RequestCancellation() const noexcept;
+
+        /**
+         * \brief Checks if the cancellation has been requested
+         * \return True if the cancellation has been requested, false otherwise
+         */
+        [[nodiscard]]
+        RkBool IsCancellationRequested() const noexcept;
+
+        /**
+         * \brief Creates a new token observing this source
+         * \return Token
+         */
+        [[nodiscard]]
+        CancellationToken GetToken() const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
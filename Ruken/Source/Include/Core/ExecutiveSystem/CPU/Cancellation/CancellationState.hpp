@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitable.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuation.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+namespace internal
+{
+    /**
+     * \brief Shared state of a cancellation source and its tokens.
+     *
+     * The state is an awaitable completed once cancellation has been requested.
+     * It can be linked to a parent state, in which case cancelling the parent cancels this state as well.
+     * The link is a continuation attached to the parent, and is detached when the state is deallocated.
+     *
+     * \note The state is reference counted and deletes itself once the last reference has been released.
+     */
+    class CancellationState final: public CPUAwaiter,
+                                   public CPUAwaitable<RkVoid, true>
+    {
+        #pragma region Members
+
+        std::atomic<RkBool>              m_requested    {false};
+        std::atomic<RkUint8>             m_link_release {1U}; ///< Parties left before deletion, 2 while linked
+        CPUAwaitableHandle<RkVoid, true> m_parent       {nullptr};
+        CPUContinuation                  m_parent_link  {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Releases one of the parties keeping the state alive, deletes the state when none are left
+         */
+        RkVoid Release() noexcept;
+
+        #pragma endregion
+
+        protected:
+
+            #pragma region Methods
+
+            /**
+             * \brief Detaches the state from its parent if any, and deletes it
+             */
+            RkVoid Deallocate() override;
+
+            #pragma endregion
+
+        public:
+
+            using ProcessingUnit = CentralProcessingUnit;
+
+            #pragma region Lifetime
+
+            CancellationState() = default;
+
+            /**
+             * \brief Linked state constructor
+             * \param in_parent Parent state, cancelling it will cancel this state as well
+             */
+            explicit CancellationState(CancellationState& in_parent) noexcept;
+
+            CancellationState(CancellationState const&) = delete;
+            CancellationState(CancellationState&&)      = delete;
+            ~CancellationState() override               = default;
+
+            CancellationState& operator=(CancellationState const&) = delete;
+            CancellationState& operator=(CancellationState&&)      = delete;
+
+            #pragma endregion
+
+            #pragma region Methods
+
+            /**
+             * \brief Requests the cancellation, completing the state.
+             *        Only the first request has any effect.
+             */
+            RkVoid Request() noexcept;
+
+            /**
+             * \brief Checks if the cancellation has been requested
+             * \return True if the cancellation has been requested, false otherwise
+             */
+            [[nodiscard]]
+            RkBool IsRequested() const noexcept;
+
+            /**
+             * \brief Called when the parent state has been cancelled
+             */
+            RkVoid OnAwaitedContinuation() noexcept override;
+
+            #pragma endregion
+    };
+}
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/Awaitable.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitableHandle.hpp"
+#include "Core/ExecutiveSystem/CPU/Cancellation/CancellationState.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Observes the cancellation requests of a CancellationSource.
+ *
+ * Tokens are cheap to copy and can be passed to any task. Cancellation is cooperative,
+ * tasks can either poll the token or await it, in which case they are resumed once the cancellation has been requested.
+ *
+ * \code
+ * while (!in_token.IsCancellationRequested())
+ *     co_await LoadNextChunk();
+ * \endcode
+ *
+ * \note Default constructed tokens can never be cancelled and must not be awaited.
+ */
+struct CancellationToken final: Awaitable<CentralProcessingUnit, RkVoid, true>, CPUAwaitableHandle<RkVoid, true>
+{
+    private:
+
+        #pragma region Members
+
+        internal::CancellationState* m_state {nullptr};
+
+        #pragma endregion
+
+    public:
+
+        using ProcessingUnit = CentralProcessingUnit;
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Constructs a token that can never be cancelled
+         */
+        CancellationToken() noexcept;
+
+        /**
+         * \brief Constructs a token observing the passed state
+         * \param in_state Observed state
+         */
+        explicit CancellationToken(internal::CancellationState& in_state) noexcept;
+
+        CancellationToken(CancellationToken const&) = default;
+        CancellationToken(CancellationToken&&)      = default;
+        ~CancellationToken()                        = default;
+
+        CancellationToken& operator=(CancellationToken const&) = default;
+        CancellationToken& operator=(CancellationToken&&)      = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Checks if the cancellation has been requested
+         * \return True if the cancellation has been requested, false otherwise
+         */
+        [[nodiscard]]
+        RkBool IsCancellationRequested() const noexcept;
+
+        /**
+         * \brief Checks if the token is bound to a source and can thus be cancelled
+         * \return True if the token can be cancelled, false otherwise
+         */
+        [[nodiscard]]
+        RkBool CanBeCancelled() const noexcept;
+
+        /**
+         * \brief Returns the observed state
+         * \return Observed state, nullptr if the token can never be cancelled
+         */
+        [[nodiscard]]
+        internal::CancellationState* GetState() const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -3,6 +3,8 @@
 #include <vector>
 
 #include "Core/ExecutiveSystem/CPU/Worker.hpp"
+#include "Core/ExecutiveSystem/CPU/Metrics/WorkerMetrics.hpp"
+#include "Core/ExecutiveSystem/CPU/Metrics/CPUMetricsSnapshot.hpp"
 #include "Core/ExecutiveSystem/ProcessingUnit.hpp"
 
 BEGIN_RUKEN_NAMESPACE
@@ -21,8 +23,9 @@ class CentralProcessingUnit final: public ProcessingUnit<CentralProcessingUnit,
 
     #pragma region Members
 
-    std::vector<CentralProcessingQueue*> m_queues  {};
-    std::vector<std::unique_ptr<Worker>> m_workers {};
+    std::vector<CentralProcessingQueue*> m_queues         {};
+    std::vector<std::unique_ptr<Worker>> m_workers        {};
+    mutable WorkerMetrics                m_caller_metrics {}; ///< Shared by every thread captured through CallerAsWorker
 
     #pragma endregion
 
@@ -32,6 +35,13 @@ class CentralProcessingUnit final: public ProcessingUnit<CentralProcessingUnit,
 
 		explicit CentralProcessingUnit() noexcept;
 
+        /**
+         * \brief Constructs the unit with a fixed number of background workers
+         * \param in_workers_count Number of workers to spawn, the calling thread can still be captured on top of them
+         * \param in_queues Queues to register before any worker is started
+         */
+        explicit CentralProcessingUnit(RkSize in_workers_count, std::vector<CentralProcessingQueue*> in_queues = {}) noexcept;
+
         CentralProcessingUnit(CentralProcessingUnit const&) = delete;
         CentralProcessingUnit(CentralProcessingUnit&&)      = delete;
         ~CentralProcessingUnit()                            = default;
@@ -43,6 +53,8 @@ class CentralProcessingUnit final: public ProcessingUnit<CentralProcessingUnit,
         /**
          * \brief Registers the passed queue so it can be processed
          * \param in_queue Queue instance
+         * \warning Workers are reading the registered queues without any synchronization,
+         *          queues registered once workers are running should be passed to the constructor instead.
          */
         RkVoid RegisterQueue(CentralProcessingQueue& in_queue) noexcept;
 
@@ -53,6 +65,29 @@ class CentralProcessingUnit final: public ProcessingUnit<CentralProcessingUnit,
          */
         RkVoid CallerAsWorker(std::stop_token const& in_should_return) const noexcept;
 
+        /**
+         * \brief Captures the calling thread and uses it as a worker until the passed deadline,
+         *        this lets the main thread absorb some work while waiting for the next frame for instance.
+         * \note Jobs are not preempted, the deadline is only checked in between jobs. Long tasks should yield regularly (see Yield).
+         * \param in_deadline Time point past which no more job is started
+         */
+        RkVoid CallerAsWorker(std::chrono::steady_clock::time_point in_deadline) const noexcept;
+
+        /**
+         * \brief Takes a snapshot of the runtime metrics of every worker and registered queue.
+         *        This is cheap enough to be called every frame.
+         * \return Metrics snapshot
+         */
+        [[nodiscard]]
+        CPUMetricsSnapshot GetMetricsSnapshot() const noexcept;
+
+        /**
+         * \brief Returns the background workers of the unit
+         * \return Workers
+         */
+        [[nodiscard]]
+        std::vector<std::unique_ptr<Worker>> const& GetWorkers() const noexcept;
+
         #pragma endregion
 
         #pragma region Operators
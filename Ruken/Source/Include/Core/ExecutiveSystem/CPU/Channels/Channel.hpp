@@ -0,0 +1,412 @@
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <vector>
+#include <atomic>
+#include <optional>
+#include <coroutine>
+#include <atomic_queue/atomic_queue.h>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuation.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuationQueue.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Multi producer, multi consumer asynchronous channel.
+ *
+ * Senders are suspended while the channel is full and receivers while it is empty, no worker is ever blocked.
+ * Suspended tasks are served in arrival order and pushed back to their own queue once their operation completed,
+ * values are handed over directly to waiting receivers without going through the buffer.
+ *
+ * This is meant to build pipelines where each stage is a task, the capacity of the channels
+ * providing the backpressure between stages:
+ *
+ * \code
+ * Channel<Chunk> compressed {16ULL};
+ * Channel<Chunk> decompressed {16ULL};
+ *
+ * CPUTask<IOQueue> Read(File& in_file)
+ * {
+ *     while (std::optional<Chunk> chunk {co_await in_file.ReadChunk()})
+ *         co_await compressed.Send(std::move(*chunk));
+ *
+ *     compressed.Close();
+ * }
+ *
+ * CPUTask<DecompressQueue> Decompress()
+ * {
+ *     while (std::optional<Chunk> chunk {co_await compressed.Receive()})
+ *         co_await decompressed.Send(Decompress(*chunk));
+ *
+ *     decompressed.Close();
+ * }
+ * \endcode
+ *
+ * Once closed, sends fail and receivers drain the remaining values before being notified of the closure.
+ *
+ * \tparam TType Type of the values carried by the channel
+ * \warning No task must be waiting on the channel when it is destroyed
+ */
+template <typename TType>
+class Channel
+{
+    public:
+
+        /// Capacity of a channel that never suspends its senders
+        static constexpr RkSize unbounded {std::numeric_limits<RkSize>::max()};
+
+        /**
+         * \brief Awaiter sending a value through the channel
+         */
+        class SendAwaiter: CPUContinuation
+        {
+            friend Channel;
+
+            #pragma region Members
+
+            Channel& m_channel;
+            TType    m_value;
+            RkBool   m_sent {false};
+
+            #pragma endregion
+
+            public:
+
+                using ProcessingUnit = CentralProcessingUnit;
+
+                #pragma region Lifetime
+
+                /**
+                 * \brief Default constructor
+                 * \param in_channel Channel to send the value through
+                 * \param in_value Value to send
+                 */
+                SendAwaiter(Channel& in_channel, TType&& in_value);
+
+                SendAwaiter(SendAwaiter const&) = default;
+                ~SendAwaiter() = default;
+
+                SendAwaiter& operator=(SendAwaiter const&) = delete;
+                SendAwaiter& operator=(SendAwaiter&&     ) = delete;
+
+                #pragma endregion
+
+                #pragma region Methods
+
+                [[nodiscard]]
+                RkBool await_ready() const noexcept
+                { return false; }
+
+                /**
+                 * \brief Sends the value or suspends the awaiting task until it can be sent
+                 * \note Buffering the value may throw, the exception is then rethrown in the awaiting task.
+                 * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+                 * \param in_handle Handle of the awaiting task
+                 * \return True if the task has been suspended, false if the operation already completed
+                 */
+                template <typename TPromise>
+                RkBool await_suspend(std::coroutine_handle<TPromise> in_handle);
+
+                /**
+                 * \brief Returns the result of the operation
+                 * \return True if the value has been sent, false if the channel has been closed
+                 */
+                [[nodiscard]]
+                RkBool await_resume() const noexcept
+                { return m_sent; }
+
+                #pragma endregion
+        };
+
+        /**
+         * \brief Awaiter receiving a single value from the channel
+         */
+        class ReceiveAwaiter: CPUContinuation
+        {
+            friend Channel;
+
+            protected:
+
+                #pragma region Members
+
+                Channel&             m_channel;
+                std::optional<TType> m_value {};
+
+                #pragma endregion
+
+            public:
+
+                using ProcessingUnit = CentralProcessingUnit;
+
+                #pragma region Lifetime
+
+                /**
+                 * \brief Default constructor
+                 * \param in_channel Channel to receive the value from
+                 */
+                explicit ReceiveAwaiter(Channel& in_channel) noexcept;
+
+                ReceiveAwaiter(ReceiveAwaiter const& in_copy) noexcept;
+                ~ReceiveAwaiter() = default;
+
+                ReceiveAwaiter& operator=(ReceiveAwaiter const&) = delete;
+                ReceiveAwaiter& operator=(ReceiveAwaiter&&     ) = delete;
+
+                #pragma endregion
+
+                #pragma region Methods
+
+                [[nodiscard]]
+                RkBool await_ready() const noexcept
+                { return false; }
+
+                /**
+                 * \brief Receives a value or suspends the awaiting task until one is available
+                 * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+                 * \param in_handle Handle of the awaiting task
+                 * \return True if the task has been suspended, false if the operation already completed
+                 */
+                template <typename TPromise>
+                RkBool await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept;
+
+                /**
+                 * \brief Returns the result of the operation
+                 * \return Received value, or an empty optional if the channel has been closed and drained
+                 */
+                [[nodiscard]]
+                std::optional<TType> await_resume() noexcept
+                { return std::move(m_value); }
+
+                #pragma endregion
+        };
+
+        /**
+         * \brief Awaiter receiving every available value from the channel, up to a maximum count
+         */
+        class ReceiveBatchAwaiter: ReceiveAwaiter
+        {
+            #pragma region Members
+
+            RkSize             m_max_count;
+            std::vector<TType> m_values {};
+
+            #pragma endregion
+
+            public:
+
+                using ProcessingUnit = CentralProcessingUnit;
+
+                #pragma region Lifetime
+
+                /**
+                 * \brief Default constructor
+                 * \param in_channel Channel to receive the values from
+                 * \param in_max_count Maximum number of values to receive
+                 */
+                ReceiveBatchAwaiter(Channel& in_channel, RkSize in_max_count) noexcept;
+
+                ReceiveBatchAwaiter(ReceiveBatchAwaiter const& in_copy) noexcept;
+                ~ReceiveBatchAwaiter() = default;
+
+                ReceiveBatchAwaiter& operator=(ReceiveBatchAwaiter const&) = delete;
+                ReceiveBatchAwaiter& operator=(ReceiveBatchAwaiter&&     ) = delete;
+
+                #pragma endregion
+
+                #pragma region Methods
+
+                using ReceiveAwaiter::await_ready;
+
+                /**
+                 * \brief Receives the available values or suspends the awaiting task until at least one is available
+                 * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+                 * \param in_handle Handle of the awaiting task
+                 * \return True if the task has been suspended, false if the operation already completed
+                 */
+                template <typename TPromise>
+                RkBool await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept;
+
+                /**
+                 * \brief Returns the result of the operation
+                 * \return Received values, empty only if the channel has been closed and drained
+                 */
+                [[nodiscard]]
+                std::vector<TType> await_resume() noexcept;
+
+                #pragma endregion
+        };
+
+    private:
+
+        #pragma region Members
+
+        std::atomic_flag     m_guard     {}; ///< Protects the state of the channel, only held for a few instructions
+        RkSize               m_capacity;
+        RkBool               m_closed    {false};
+        std::deque<TType>    m_buffer    {};
+        CPUContinuationQueue m_senders   {}; ///< Suspended SendAwaiter instances
+        CPUContinuationQueue m_receivers {}; ///< Suspended ReceiveAwaiter instances
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Acquires the guard of the channel state
+         */
+        RkVoid LockState() noexcept;
+
+        /**
+         * \brief Releases the guard of the channel state
+         */
+        RkVoid UnlockState() noexcept;
+
+        /**
+         * \brief Attempts to send a value, the guard of the state must be held
+         * \note Buffering the value may throw, the guard is left held in that case
+         * \param inout_value Value to send, only moved from if the value has been sent
+         * \param inout_resumed Receivers to notify once the guard is released
+         * \return True if the value has been sent, false otherwise
+         */
+        RkBool TrySendUnsafe(TType& inout_value, CPUContinuationQueue& inout_resumed);
+
+        /**
+         * \brief Attempts to receive a value, the guard of the state must be held
+         * \param out_value Received value
+         * \param inout_resumed Senders to notify once the guard is released
+         * \return True if a value has been received, false otherwise
+         */
+        RkBool TryReceiveUnsafe(std::optional<TType>& out_value, CPUContinuationQueue& inout_resumed) noexcept;
+
+        /**
+         * \brief Receives every available value up to the passed count
+         * \param in_max_count Maximum number of values to receive
+         * \param out_values Received values
+         * \return True if at least one value has been received, false otherwise
+         */
+        RkBool ReceiveAvailable(RkSize in_max_count, std::vector<TType>& out_values) noexcept;
+
+        /**
+         * \brief Sends the value of the awaiter or appends it to the suspended senders
+         * \param inout_awaiter Send awaiter
+         * \param inout_owner Awaiting task
+         * \return True if the task has been suspended, false if the operation already completed
+         */
+        RkBool SuspendSend(SendAwaiter& inout_awaiter, CPUAwaiter& inout_owner);
+
+        /**
+         * \brief Receives a value into the awaiter or appends it to the suspended receivers
+         * \param inout_awaiter Receive awaiter
+         * \param inout_owner Awaiting task
+         * \return True if the task has been suspended, false if the operation already completed
+         */
+        RkBool SuspendReceive(ReceiveAwaiter& inout_awaiter, CPUAwaiter& inout_owner) noexcept;
+
+        /**
+         * \brief Notifies the owners of the passed continuations
+         * \param inout_resumed Continuations to notify
+         */
+        static RkVoid Resume(CPUContinuationQueue& inout_resumed) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor
+         * \param in_capacity Maximum number of buffered values, 0 makes every send wait for a receiver
+         */
+        explicit Channel(RkSize in_capacity = unbounded) noexcept;
+
+        Channel(Channel const&) = delete;
+        Channel(Channel&&     ) = delete;
+        ~Channel()              = default;
+
+        Channel& operator=(Channel const&) = delete;
+        Channel& operator=(Channel&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Sends a value, the awaiting task is suspended while the channel is full
+         * \note Buffering the value may throw std::bad_alloc, as well as any constructor of TType
+         * \param in_value Value to send
+         * \return Awaiter, returning false if the channel has been closed
+         */
+        [[nodiscard]]
+        SendAwaiter Send(TType in_value);
+
+        /**
+         * \brief Attempts to send a value without suspending
+         * \note Buffering the value may throw std::bad_alloc, as well as any constructor of TType.
+         *       The value is not sent in that case.
+         * \param in_value Value to send
+         * \return True if the value has been sent, false if the channel is full or closed
+         */
+        RkBool TrySend(TType in_value);
+
+        /**
+         * \brief Receives a value, the awaiting task is suspended while the channel is empty
+         * \return Awaiter, returning an empty optional once the channel has been closed and drained
+         */
+        [[nodiscard]]
+        ReceiveAwaiter Receive() noexcept;
+
+        /**
+         * \brief Receives every available value up to the passed count,
+         *        the awaiting task is suspended while the channel is empty
+         * \param in_max_count Maximum number of values to receive
+         * \return Awaiter, returning an empty vector once the channel has been closed and drained
+         */
+        [[nodiscard]]
+        ReceiveBatchAwaiter ReceiveBatch(RkSize in_max_count) noexcept;
+
+        /**
+         * \brief Attempts to receive a value without suspending
+         * \return Received value, or an empty optional if the channel is empty
+         */
+        [[nodiscard]]
+        std::optional<TType> TryReceive() noexcept;
+
+        /**
+         * \brief Closes the channel, suspended senders and receivers are resumed.
+         *        Buffered values can still be received.
+         */
+        RkVoid Close() noexcept;
+
+        /**
+         * \brief Checks if the channel has been closed
+         * \return True if the channel has been closed, false otherwise
+         */
+        [[nodiscard]]
+        RkBool IsClosed() noexcept;
+
+        /**
+         * \brief Returns the number of buffered values
+         * \warning Synchronization cannot be achieved with this function.
+         * \return Buffered values
+         */
+        [[nodiscard]]
+        RkSize GetSize() noexcept;
+
+        /**
+         * \brief Returns the capacity of the channel
+         * \return Capacity
+         */
+        [[nodiscard]]
+        RkSize GetCapacity() const noexcept;
+
+        #pragma endregion
+};
+
+#include "Core/ExecutiveSystem/CPU/Channels/Channel.inl"
+
+END_RUKEN_NAMESPACE
@@ -21,6 +21,10 @@ BEGIN_RUKEN_NAMESPACE
  *  - expired: The event (list) that this subscription (node) was part of has expired.
  *
  * Any other values simply acts as a classic linked list node pointer.
+ *
+ * Copying a continuation never copies its links: a copy is always detached. Awaiters embedding
+ * a continuation can thus be copied with their defaulted copy constructor, as they are only ever copied
+ * before being awaited.
  */
 struct CPUContinuation
 {
@@ -38,6 +42,20 @@ struct CPUContinuation
 
     #pragma endregion
 
+    #pragma region Lifetime
+
+    CPUContinuation() = default;
+
+    CPUContinuation(CPUContinuation const&) noexcept:
+        CPUContinuation {}
+    {}
+
+    ~CPUContinuation() = default;
+
+    CPUContinuation& operator=(CPUContinuation const&) = delete;
+
+    #pragma endregion
+
     #pragma region Methods
 
     template <typename TResult, RkBool TNoexcept>
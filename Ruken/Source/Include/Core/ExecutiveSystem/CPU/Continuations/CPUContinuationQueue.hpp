@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Continuations/CPUContinuation.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief First in first out list of continuations, linked through their next pointer.
+ * \warning This list is not thread safe and must be externally synchronized
+ */
+struct CPUContinuationQueue
+{
+    #pragma region Members
+
+    CPUContinuation* head {nullptr};
+    CPUContinuation* tail {nullptr};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    /**
+     * \brief Checks if the queue is empty
+     * \return True if the queue is empty, false otherwise
+     */
+    [[nodiscard]]
+    RkBool Empty() const noexcept
+    { return head == nullptr; }
+
+    /**
+     * \brief Appends a continuation at the end of the queue
+     * \param inout_continuation Continuation to append
+     */
+    RkVoid Push(CPUContinuation& inout_continuation) noexcept
+    {
+        inout_continuation.next.store(nullptr, std::memory_order_relaxed);
+
+        if (tail) tail->next.store(std::addressof(inout_continuation), std::memory_order_relaxed);
+        else      head = std::addressof(inout_continuation);
+
+        tail = std::addressof(inout_continuation);
+    }
+
+    /**
+     * \brief Removes the first continuation of the queue
+     * \return Removed continuation, nullptr if the queue was empty
+     */
+    CPUContinuation* Pop() noexcept
+    {
+        CPUContinuation* const continuation {head};
+
+        if (continuation)
+        {
+            head = continuation->next.load(std::memory_order_relaxed);
+
+            if (head == nullptr)
+                tail = nullptr;
+        }
+
+        return continuation;
+    }
+
+    #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
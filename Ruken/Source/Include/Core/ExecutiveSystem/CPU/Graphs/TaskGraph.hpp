@@ -0,0 +1,230 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <coroutine>
+#include <functional>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/Concepts/QueueHandleType.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaitable.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CentralProcessingQueue.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+namespace internal
+{
+    /**
+     * \brief Persistent coroutine running a single node of a task graph once per resumption
+     */
+    struct TaskGraphRoutine
+    {
+        struct promise_type
+        {
+            TaskGraphRoutine get_return_object() noexcept
+            { return TaskGraphRoutine {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            std::suspend_always final_suspend  () const noexcept { return {}; }
+
+            RkVoid return_void        () const noexcept {}
+            RkVoid unhandled_exception() const noexcept { std::terminate(); }
+        };
+
+        std::coroutine_handle<promise_type> handle {};
+    };
+}
+
+/**
+ * \brief Recorded graph of callables with explicit dependencies, compiled once and launched as many times as needed.
+ *
+ * This is the deferred counterpart of regular CPU tasks (see EExecutionPolicy::Deferred): the graph is recorded,
+ * then compiled, which precomputes the dependency counts and topological levels of every node and allocates
+ * one persistent coroutine per node. Launching the graph then only resets the counters and pushes the root nodes,
+ * no allocation or continuation wiring happens per launch.
+ *
+ * \code
+ * TaskGraph frame;
+ *
+ * TaskGraph::NodeId const input     {frame.AddNode<GameplayQueue>("Input"    , [&] { input.Update();     })};
+ * TaskGraph::NodeId const physics   {frame.AddNode<GameplayQueue>("Physics"  , [&] { physics.Update();   })};
+ * TaskGraph::NodeId const animation {frame.AddNode<GameplayQueue>("Animation", [&] { animation.Update(); })};
+ * TaskGraph::NodeId const render    {frame.AddNode<RenderQueue>  ("Render"   , [&] { renderer.Update();  })};
+ *
+ * frame.AddDependency(input    , physics);
+ * frame.AddDependency(physics  , render);
+ * frame.AddDependency(animation, render);
+ * frame.Compile();
+ *
+ * while (running)
+ *     co_await frame.Launch();
+ * \endcode
+ *
+ * If any node raised an exception, the remaining nodes are still executed and the first exception is rethrown to the awaiter.
+ *
+ * \note A graph cannot be modified once compiled, and must be completed before being launched again or destroyed.
+ */
+class TaskGraph final: public CPUAwaitable<RkVoid, false>
+{
+    public:
+
+        using NodeId = RkSize;
+
+        /**
+         * \brief Recorded node of the graph
+         */
+        struct Node
+        {
+            std::string              name         {};
+            std::function<RkVoid()>  work         {};
+            CentralProcessingQueue*  queue        {nullptr};
+            std::vector<NodeId>      successors   {};
+            RkSize                   dependencies {0ULL}; ///< Number of nodes this one depends on
+            RkSize                   level        {0ULL}; ///< Topological level, 0 for the root nodes
+        };
+
+    private:
+
+        #pragma region Members
+
+        std::vector<Node>                      m_nodes     {};
+        std::vector<NodeId>                    m_roots     {};
+        std::vector<internal::TaskGraphRoutine> m_routines  {};
+        std::unique_ptr<std::atomic<RkSize>[]> m_pending   {}; ///< Remaining dependencies of each node for the current launch
+        std::atomic<RkSize>                    m_remaining {0ULL};
+        std::atomic_flag                       m_faulted   {};
+        RkSize                                 m_levels    {0ULL};
+        RkBool                                 m_compiled  {false};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Persistent routine of a node, executes the node every time it is resumed
+         * \param in_node Node to execute
+         */
+        internal::TaskGraphRoutine Routine(NodeId in_node);
+
+        /**
+         * \brief Called by a node once suspended, releases its successors and completes the graph if needed
+         * \param in_node Completed node
+         */
+        RkVoid OnNodeCompleted(NodeId in_node) noexcept;
+
+        #pragma endregion
+
+    protected:
+
+        #pragma region Methods
+
+        RkVoid Deallocate() override
+        {}
+
+        #pragma endregion
+
+    public:
+
+        using ProcessingUnit = CentralProcessingUnit;
+
+        #pragma region Lifetime
+
+        TaskGraph() = default;
+
+        TaskGraph(TaskGraph const&) = delete;
+        TaskGraph(TaskGraph&&)      = delete;
+        ~TaskGraph() noexcept override;
+
+        TaskGraph& operator=(TaskGraph const&) = delete;
+        TaskGraph& operator=(TaskGraph&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Records a new node
+         * \param in_queue Queue the node will be executed on
+         * \param in_name Name of the node, used for introspection only
+         * \param in_work Callable to execute
+         * \return Identifier of the node
+         * \warning Adding nodes to a compiled graph is undefined behavior
+         */
+        NodeId AddNode(CentralProcessingQueue& in_queue, std::string in_name, std::function<RkVoid()> in_work);
+
+        /**
+         * \brief Records a new node
+         * \tparam TQueueHandle Queue the node will be executed on
+         * \param in_name Name of the node, used for introspection only
+         * \param in_work Callable to execute
+         * \return Identifier of the node
+         * \warning Adding nodes to a compiled graph is undefined behavior
+         */
+        template <QueueHandleType TQueueHandle>
+        NodeId AddNode(std::string in_name, std::function<RkVoid()> in_work)
+        { return AddNode(TQueueHandle::GetInstance(), std::move(in_name), std::move(in_work)); }
+
+        /**
+         * \brief Records a dependency between two nodes
+         * \param in_before Node that has to be completed first
+         * \param in_after Node depending on the first one
+         * \warning Adding dependencies to a compiled graph is undefined behavior
+         */
+        RkVoid AddDependency(NodeId in_before, NodeId in_after);
+
+        /**
+         * \brief Computes the dependency counts and topological levels of the graph and allocates the node routines
+         * \return True if the graph could be compiled, false if it contains a cycle
+         */
+        RkBool Compile();
+
+        /**
+         * \brief Resets the counters of the graph and pushes its root nodes.
+         *        The graph completes once every node has been executed.
+         * \return Reference onto the graph so it can be directly awaited
+         * \warning The graph must be compiled, and the previous launch must have been completed
+         */
+        [[nodiscard]]
+        TaskGraph& Launch() noexcept;
+
+        /**
+         * \brief Checks if the graph has been compiled
+         * \return True if the graph has been compiled, false otherwise
+         */
+        [[nodiscard]]
+        RkBool IsCompiled() const noexcept;
+
+        /**
+         * \brief Returns the recorded nodes, indexed by their identifier
+         * \return Nodes
+         */
+        [[nodiscard]]
+        std::vector<Node> const& GetNodes() const noexcept;
+
+        /**
+         * \brief Returns the nodes without any dependency, only valid once compiled
+         * \return Root nodes
+         */
+        [[nodiscard]]
+        std::vector<NodeId> const& GetRoots() const noexcept;
+
+        /**
+         * \brief Returns the number of topological levels, only valid once compiled
+         * \return Level count, also the length of the longest dependency chain
+         */
+        [[nodiscard]]
+        RkSize GetLevelCount() const noexcept;
+
+        /**
+         * \brief Writes the graph as a mermaid flowchart, nodes being grouped by topological level.
+         *        Only valid once compiled.
+         * \param inout_stream Output stream
+         */
+        RkVoid DumpMermaid(std::ostream& inout_stream) const;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <coroutine>
+#include <type_traits>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+#include "Core/ExecutiveSystem/CPU/IO/CPUIOService.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Base class of every blocking I/O operation that can be awaited by CPU tasks.
+ *
+ * Upon suspension, the request is submitted to the CPUIOService which executes it on one of its dedicated threads.
+ * Once executed, the awaiting task is pushed back to its own queue.
+ */
+class CPUIORequest
+{
+    friend class CPUIOService;
+
+    #pragma region Members
+
+    CPUAwaiter*   m_owner {nullptr};
+    CPUIORequest* m_next  {nullptr};
+
+    #pragma endregion
+
+    protected:
+
+        #pragma region Methods
+
+        /**
+         * \brief Executes the blocking operation, called from an I/O thread.
+         */
+        virtual RkVoid Execute() noexcept = 0;
+
+        #pragma endregion
+
+    public:
+
+        using ProcessingUnit = CentralProcessingUnit;
+
+        #pragma region Lifetime
+
+        CPUIORequest()                    = default;
+        CPUIORequest(CPUIORequest const&) = delete;
+        CPUIORequest(CPUIORequest&&     ) = delete;
+        virtual ~CPUIORequest()           = default;
+
+        CPUIORequest& operator=(CPUIORequest const&) = delete;
+        CPUIORequest& operator=(CPUIORequest&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief I/O requests are never ready before being executed
+         * \return False
+         */
+        [[nodiscard]]
+        RkBool await_ready() const noexcept
+        { return false; }
+
+        /**
+         * \brief Submits the request to the I/O service
+         * \note If the request cannot be submitted, the exception is rethrown in the awaiting task (see CPUIOService::Submit)
+         * \tparam TPromise Promise type of the task, must be a CPUAwaiter
+         * \param in_handle Handle of the suspended task
+         */
+        template <typename TPromise>
+        RkVoid await_suspend(std::coroutine_handle<TPromise> in_handle);
+
+        #pragma endregion
+};
+
+#include "Core/ExecutiveSystem/CPU/IO/CPUIORequest.inl"
+
+END_RUKEN_NAMESPACE
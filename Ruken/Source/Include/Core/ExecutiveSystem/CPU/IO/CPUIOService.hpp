@@ -0,0 +1,111 @@
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <condition_variable>
+
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class CPUIORequest;
+
+/**
+ * \brief Blocking thread pool of the central processing unit.
+ *
+ * Blocking operations (file I/O, third party loaders, driver waits...) are executed on dedicated threads
+ * so that CPU workers, whose count matches the core count, never stall. Once an operation has been executed,
+ * the awaiting task is pushed back to its own queue, overlapping the wait with the processing of the other tasks.
+ *
+ * The pool is elastic: since its threads spend most of their time blocked, a new thread is started whenever
+ * a request is submitted while every thread is busy, up to max_thread_count. Threads left idle for longer than
+ * idle_timeout are retired, down to min_thread_count.
+ *
+ * \note Threads are only started on demand, nothing runs until the first submission.
+ */
+class CPUIOService
+{
+    #pragma region Members
+
+    std::mutex                  m_mutex         {};
+    std::condition_variable_any m_notification  {};
+    CPUIORequest*               m_head          {nullptr};
+    CPUIORequest*               m_tail          {nullptr};
+    RkSize                      m_pending_count {0ULL};
+    RkSize                      m_idle_count    {0ULL};
+    RkSize                      m_started_count {0ULL};
+    std::list<std::jthread>     m_threads       {};
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    /**
+     * \brief Starts a new thread
+     * \note The mutex must be held by the caller. Throws std::system_error if the thread could not be started.
+     */
+    RkVoid StartThread();
+
+    /**
+     * \brief Routine of the blocking threads, executes requests until a stop is requested or the thread is retired
+     * \param in_stop_token Stop token
+     * \param in_name Name of the thread
+     */
+    RkVoid Routine(std::stop_token const& in_stop_token, std::string const& in_name) noexcept;
+
+    #pragma endregion
+
+    public:
+
+        // Number of threads kept alive once started, even when idle
+        static constexpr RkSize min_thread_count {4ULL};
+
+        // Upper bound of the pool, requests are queued once every thread is blocked
+        static constexpr RkSize max_thread_count {64ULL};
+
+        // Duration after which an idle thread is retired, as long as there are more than min_thread_count threads
+        static constexpr std::chrono::milliseconds idle_timeout {5000};
+
+        #pragma region Lifetime
+
+        CPUIOService()                    = default;
+        CPUIOService(CPUIOService const&) = delete;
+        CPUIOService(CPUIOService&&     ) = delete;
+        ~CPUIOService() noexcept;
+
+        CPUIOService& operator=(CPUIOService const&) = delete;
+        CPUIOService& operator=(CPUIOService&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the I/O service instance
+         * \return I/O service instance
+         */
+        static CPUIOService& GetInstance() noexcept;
+
+        /**
+         * \brief Submits a request for execution
+         * \note The request must stay alive until its owner has been notified.
+         *       Failing to start a thread only throws (std::system_error) if the pool has no thread at all,
+         *       the request is not submitted in that case.
+         * \param in_request Request to execute
+         */
+        RkVoid Submit(CPUIORequest& in_request);
+
+        /**
+         * \brief Returns the current number of threads of the pool
+         * \return Thread count
+         */
+        [[nodiscard]]
+        RkSize GetThreadCount() noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Defines how a file handle is opened
+ *
+ * Read  => Opens an existing file for reading
+ * Write => Creates or truncates a file for writing
+ */
+enum class EFileAccess : RkUint8
+{
+    Read,
+    Write
+};
+
+END_RUKEN_NAMESPACE
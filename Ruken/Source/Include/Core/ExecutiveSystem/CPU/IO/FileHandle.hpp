@@ -0,0 +1,83 @@
+#pragma once
+
+#include <span>
+#include <filesystem>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/IO/EFileAccess.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Owning handle over an operating system file.
+ *
+ * Reads and writes are positional and blocking, they do not depend on any file cursor
+ * and can thus safely be issued from multiple threads at once.
+ * Prefer the asynchronous ReadAt awaiter over calling ReadAt directly from a task.
+ */
+class FileHandle
+{
+    private:
+
+        RkVoid* m_win_handle {nullptr};
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Opens the passed file
+         * \param in_path Path of the file to open
+         * \param in_access File access
+         */
+        FileHandle (std::filesystem::path const& in_path, EFileAccess in_access) noexcept;
+        FileHandle (FileHandle const& in_copy) = delete;
+        FileHandle (FileHandle&&      in_move) noexcept;
+        ~FileHandle() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Checks if the file has been successfully opened
+         * \return True if the file is open, false otherwise
+         */
+        [[nodiscard]]
+        RkBool IsOpen() const noexcept;
+
+        /**
+         * \brief Queries the size of the file
+         * \return Size of the file in bytes, 0 if the file is not open
+         */
+        [[nodiscard]]
+        RkSize GetSize() const noexcept;
+
+        /**
+         * \brief Blocking positional read
+         * \param in_offset Offset in bytes from the beginning of the file
+         * \param out_buffer Buffer to fill
+         * \return Number of bytes read, can be smaller than the buffer if the end of the file has been reached or in case of failure
+         */
+        RkSize ReadAt(RkSize in_offset, std::span<RkByte> out_buffer) const noexcept;
+
+        /**
+         * \brief Blocking positional write
+         * \param in_offset Offset in bytes from the beginning of the file
+         * \param in_buffer Data to write
+         * \return Number of bytes written, smaller than the buffer in case of failure
+         */
+        RkSize WriteAt(RkSize in_offset, std::span<RkByte const> in_buffer) const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        FileHandle& operator=(FileHandle const& in_copy) = delete;
+        FileHandle& operator=(FileHandle&&      in_move) noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
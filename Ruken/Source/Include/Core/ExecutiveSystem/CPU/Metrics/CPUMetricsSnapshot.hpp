@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include <ostream>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Metrics/WorkerMetrics.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class CentralProcessingQueue;
+
+/**
+ * \brief Counters of a single queue, taken at some point in time
+ */
+struct QueueMetricsSnapshot
+{
+    CentralProcessingQueue const* queue                 {nullptr};
+    RkUint64                      executed_jobs         {0ULL}; ///< Jobs dequeued and resumed
+    RkUint64                      empty_polls           {0ULL}; ///< Dequeue attempts that timed out on an empty queue
+    RkSize                        depth                 {0ULL}; ///< Jobs currently waiting in the queue
+    RkSize                        depth_high_water_mark {0ULL}; ///< Largest depth ever reached
+    RkSize                        overflow_count        {0ULL}; ///< Pushes that exceeded the capacity of the queue
+    RkSize                        missed_deadline_count {0ULL}; ///< Jobs dequeued after the explicit deadline of the queue
+};
+
+/**
+ * \brief Runtime metrics of a central processing unit, see CentralProcessingUnit::GetMetricsSnapshot.
+ *
+ * Counters are cumulative since the creation of the unit, comparing two snapshots gives the activity in between.
+ * Streaming a snapshot writes a human readable summary, one line per worker and per queue.
+ */
+struct CPUMetricsSnapshot
+{
+    #pragma region Members
+
+    std::chrono::steady_clock::time_point time_point {};
+    std::vector<WorkerMetrics::Snapshot>  workers    {}; ///< Background workers, in the same order as CentralProcessingUnit::GetWorkers
+    WorkerMetrics::Snapshot               callers    {}; ///< Threads captured through CentralProcessingUnit::CallerAsWorker
+    std::vector<QueueMetricsSnapshot>     queues     {}; ///< Queues, in registration order
+
+    #pragma endregion
+
+    #pragma region Operators
+
+    friend std::ostream& operator<<(std::ostream& inout_stream, CPUMetricsSnapshot const& in_snapshot);
+
+    #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Runtime counters of a thread executing CPU jobs (see WorkerInfo::metrics).
+ *
+ * Counters are accumulated locally while processing the queues and only published once per queue or per cycle,
+ * keeping the cost independent of the number of executed jobs. Every counter only ever grows,
+ * rates are obtained by comparing two snapshots (see CentralProcessingUnit::GetMetricsSnapshot).
+ */
+struct WorkerMetrics
+{
+    /**
+     * \brief Plain copy of the counters, taken at some point in time
+     */
+    struct Snapshot
+    {
+        RkUint64                 executed_jobs        {0ULL}; ///< Jobs dequeued and resumed
+        RkUint64                 continuation_resumes {0ULL}; ///< Continuations resumed in place, through symmetric transfer
+        RkUint64                 empty_polls          {0ULL}; ///< Dequeue attempts that timed out on an empty queue
+        RkUint64                 queue_switches       {0ULL}; ///< Times jobs have been taken from another queue than the previous ones
+        std::chrono::nanoseconds busy_time            {0};    ///< Time spent in cycles that executed at least one job
+        std::chrono::nanoseconds idle_time            {0};    ///< Time spent spinning over empty queues or parked
+    };
+
+    #pragma region Members
+
+    std::atomic<RkUint64> executed_jobs        {0ULL};
+    std::atomic<RkUint64> continuation_resumes {0ULL};
+    std::atomic<RkUint64> empty_polls          {0ULL};
+    std::atomic<RkUint64> queue_switches       {0ULL};
+    std::atomic<RkInt64>  busy_time            {0LL}; ///< In nanoseconds
+    std::atomic<RkInt64>  idle_time            {0LL}; ///< In nanoseconds
+
+    #pragma endregion
+
+    #pragma region Methods
+
+    /**
+     * \brief Copies the current value of every counter
+     * \note Counters are read one by one, the snapshot might be slightly inconsistent while the worker is running.
+     * \return Snapshot
+     */
+    [[nodiscard]]
+    Snapshot TakeSnapshot() const noexcept
+    {
+        return Snapshot {
+            .executed_jobs        = executed_jobs       .load(std::memory_order_relaxed),
+            .continuation_resumes = continuation_resumes.load(std::memory_order_relaxed),
+            .empty_polls          = empty_polls         .load(std::memory_order_relaxed),
+            .queue_switches       = queue_switches      .load(std::memory_order_relaxed),
+            .busy_time            = std::chrono::nanoseconds {busy_time.load(std::memory_order_relaxed)},
+            .idle_time            = std::chrono::nanoseconds {idle_time.load(std::memory_order_relaxed)}
+        };
+    }
+
+    #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
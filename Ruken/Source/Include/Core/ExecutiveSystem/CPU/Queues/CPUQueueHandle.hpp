@@ -16,11 +16,12 @@ BEGIN_RUKEN_NAMESPACE
  * \tparam TInheriting Inheriting class (CRTP).
  * \tparam TSize Size of the queue. Do note that this size is only
  *				 indicative and may not correspond to the underlying implementation's chosen size.
+ * \tparam TPriority Initial priority of the queue, higher values are served first (see CentralProcessingQueue)
  */
-template <typename TInheriting, RkSize TSize>
+template <typename TInheriting, RkSize TSize, RkUint8 TPriority = CentralProcessingQueue::default_priority>
 struct CPUQueueHandle: QueueHandle<CentralProcessingUnit>
 {
-    static inline CentralProcessingQueue instance {TSize};
+    static inline CentralProcessingQueue instance {TSize, TPriority};
 
     static CentralProcessingQueue& GetInstance() noexcept
     { return instance; }
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <coroutine>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CentralProcessingQueue.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Batches the tasks spawned by the current thread, pushing them to their queues all at once.
+ *
+ * While a batch is alive, newly created CPU tasks are not pushed individually to their queue anymore.
+ * They are instead deferred until the batch is submitted or destroyed, at which point
+ * each queue receives all of its tasks through a single CentralProcessingQueue::PushBulk.
+ * This is meant for wide fan-outs, which would otherwise update the concurrency of the queue once per task.
+ *
+ * \code
+ * std::vector<CPUTask<GameplayQueue>> tasks {};
+ * {
+ *     CPUSpawnBatch batch {chunks.size()};
+ *
+ *     for (Chunk& chunk: chunks)
+ *         tasks.emplace_back(ProcessChunk(chunk));
+ * }
+ *
+ * co_await WhenAll(tasks);
+ * \endcode
+ *
+ * Batches can be nested, tasks are only deferred by the innermost one.
+ *
+ * \warning The batch is bound to the current thread, the creating task must not be suspended while it is alive.
+ *          Awaiting a deferred task before the batch has been submitted would wait forever.
+ */
+class CPUSpawnBatch
+{
+    /**
+     * \brief Tasks deferred for a single queue
+     */
+    struct Group
+    {
+        CentralProcessingQueue*              queue   {nullptr};
+        std::vector<std::coroutine_handle<>> handles {};
+    };
+
+    #pragma region Members
+
+    std::vector<Group> m_groups      {};
+    RkSize             m_reservation {0ULL};
+    CPUSpawnBatch*     m_previous    {nullptr};
+
+    #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        /**
+         * \brief Default constructor, makes the batch the current one of the calling thread
+         * \param in_reservation Expected number of tasks, avoids reallocations while spawning
+         */
+        explicit CPUSpawnBatch(RkSize in_reservation = 0ULL) noexcept;
+
+        CPUSpawnBatch(CPUSpawnBatch const&) = delete;
+        CPUSpawnBatch(CPUSpawnBatch&&)      = delete;
+
+        /**
+         * \brief Submits the remaining tasks and restores the previous batch of the thread
+         */
+        ~CPUSpawnBatch() noexcept;
+
+        CPUSpawnBatch& operator=(CPUSpawnBatch const&) = delete;
+        CPUSpawnBatch& operator=(CPUSpawnBatch&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Defers the push of a task until the batch is submitted
+         * \param in_queue Queue the task has to be pushed to
+         * \param in_handle Handle of the task
+         */
+        RkVoid Defer(CentralProcessingQueue& in_queue, std::coroutine_handle<> in_handle) noexcept;
+
+        /**
+         * \brief Pushes every deferred task to its queue, the batch can be reused afterwards
+         */
+        RkVoid Submit() noexcept;
+
+        /**
+         * \brief Returns the number of deferred tasks, waiting to be submitted
+         * \return Task count
+         */
+        [[nodiscard]]
+        RkSize GetSize() const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <span>
+#include <limits>
+#include <chrono>
 #include <coroutine>
 #include <atomic_queue/atomic_queue.h>
 
@@ -24,16 +27,48 @@ struct CPUTaskSubscription;
 
 /**
  * \brief Lock-free multi-producer/multi-consumer FIFO queue.
+ *
+ * Workers serve their queues by earliest deadline first. A queue either has an explicit deadline
+ * (the end of the current frame for instance), or an implicit one derived from its priority
+ * and from the last time it has been served, so that queues left waiting are aged until they get served.
+ * Jobs dequeued after the explicit deadline of their queue are counted as missed deadlines.
  */
 class CentralProcessingQueue: public ProcessingQueue<CentralProcessingUnit>
 {
     friend const Worker; // readonly
     friend CPUTaskSubscription; // Updating m_current_concurrency
 
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        /// Priority of the queues created without an explicit one
+        static constexpr RkUint8 default_priority {128U};
+
+    private:
+
+    /**
+     * \brief Node of the overflow list, only allocated when the ring buffer of the queue is full.
+     */
+    struct OverflowNode
+    {
+        std::coroutine_handle<> handle;
+        OverflowNode*           next;
+    };
+
     #pragma region Members
 
-    std         ::atomic       <RkUint64>                m_concurrency {};
+    std         ::atomic       <RkUint64>                m_concurrency    {};
     atomic_queue::AtomicQueueB2<std::coroutine_handle<>> m_queue;
+    std         ::atomic       <OverflowNode*>           m_overflow       {};
+    std         ::atomic       <RkSize>                  m_overflow_count {};
+    std         ::atomic       <Clock::rep>              m_deadline       {0}; ///< Explicit deadline, 0 if there is none
+    std         ::atomic       <Clock::rep>              m_last_served    {0};
+    std         ::atomic       <RkSize>                  m_missed_count   {};
+    std         ::atomic       <RkUint8>                 m_priority;
+    std         ::atomic       <RkUint64>                m_executed_count   {};
+    std         ::atomic       <RkUint64>                m_empty_poll_count {};
+    std         ::atomic       <RkSize>                  m_depth_high_water {};
 
     #pragma endregion
 
@@ -43,8 +78,35 @@ class CentralProcessingQueue: public ProcessingQueue<CentralProcessingUnit>
      * \brief A simple utility function that attempts to dequeue a job and run it.
      * \param in_max_attempts Maximum amount of times the operation can be attempted before returning.
      *        A value of 0 will do nothing.
+     * \return True if a job has been run, false if every attempt timed out
+     */
+    inline RkBool TryConsumeJob(RkUint32 in_max_attempts) noexcept;
+
+    /**
+     * \brief Raises the depth high water mark of the queue if needed
+     * \param in_counter Concurrency counter of the queue, right after a push
+     */
+    RkVoid UpdateDepthHighWater(ConcurrencyCounter const& in_counter) noexcept;
+
+    /**
+     * \brief Requests one more worker for each of the pushed jobs and wakes the parked workers up
+     * \param in_count Number of jobs that have been pushed
+     */
+    RkVoid AccountPushedJobs(RkSize in_count) noexcept;
+
+    /**
+     * \brief Links a chain of overflow nodes in front of the overflow list
+     * \param in_first First node of the chain
+     * \param in_last Last node of the chain, its next pointer will be overwritten
      */
-    inline RkVoid TryConsumeJob(RkUint32 in_max_attempts) noexcept;
+    RkVoid LinkOverflow(OverflowNode* in_first, OverflowNode* in_last) noexcept;
+
+    /**
+     * \brief Moves as many overflowed jobs as possible back into the ring buffer of the queue.
+     *        Only one caller at a time can drain the list, concurrent callers will simply find it empty.
+     * \note Ordering between overflowed jobs is best-effort.
+     */
+    RkVoid DrainOverflow() noexcept;
 
     /**
      * \brief Helper function returning the signed concurrency request of the queue.
@@ -57,7 +119,7 @@ class CentralProcessingQueue: public ProcessingQueue<CentralProcessingUnit>
      *
      * \return Signed concurrency request
      */
-    inline RkFloat GetSignedConcurrencyRequest(ConcurrencyCounter const& in_concurrency, RkUint32 in_offset = 0U) const noexcept;
+    inline RkFloat GetSignedConcurrencyRequest(ConcurrencyCounter const& in_concurrency, RkInt32 in_offset = 0) const noexcept;
 
     #pragma endregion
 
@@ -68,30 +130,90 @@ class CentralProcessingQueue: public ProcessingQueue<CentralProcessingUnit>
         /**
 		 * \brief Default constructor
 		 * \param in_size Size of the queue
+		 * \param in_priority Priority of the queue, higher values are served first
 		 */
-		explicit CentralProcessingQueue(RkSize in_size) noexcept;
+		explicit CentralProcessingQueue(RkSize in_size, RkUint8 in_priority = default_priority) noexcept;
 
         CentralProcessingQueue(CentralProcessingQueue const&) = delete;
         CentralProcessingQueue(CentralProcessingQueue&&)      = delete;
-        ~CentralProcessingQueue()                             = default;
+        ~CentralProcessingQueue() noexcept;
 
         #pragma endregion
 
         #pragma region Methods
 
         /**
-         * \brief Blocking push, waits for available space in the queue 
+         * \brief Non-blocking push. When the queue is full, the job is stored
+         *        in an unbounded overflow list that workers drain back into the queue.
+         * \note Allocating an overflow node may throw std::bad_alloc, the job is not pushed in that case.
          * \param in_handle Job handle to push
          */
-        RkVoid Push(std::coroutine_handle<> in_handle) noexcept;
+        RkVoid Push(std::coroutine_handle<> in_handle);
+
+        /**
+         * \brief Non-blocking push of a batch of jobs, equivalent to pushing them one by one in order.
+         *        The concurrency of the queue is only updated once for the whole batch
+         *        and jobs exceeding the capacity of the queue are linked to the overflow list at once.
+         * \note Allocating the overflow nodes may throw std::bad_alloc, in which case only the jobs
+         *       that fit in the ring buffer are pushed.
+         * \param in_handles Job handles to push
+         */
+        RkVoid PushBulk(std::span<std::coroutine_handle<> const> in_handles);
 
         /**
          * \brief Attempts to consume jobs of the queue 
          * \param in_sticky When set to true the queue will continue
          *        to consume jobs until the queue no longer requires this much concurrency.
          * \param in_stop_token Stop token. Only useful when in_sticky is true to preemptively stop the loop.
+         * \param in_max_rounds Maximum number of rounds of 10 jobs a sticky caller can consume before returning
+         * \param in_deadline Time point past which no more job is started, the job running at that time is still completed
+         * \return Number of jobs run by the caller
+         */
+        RkSize PopAndRun(RkBool                   in_sticky,
+                         std::stop_token   const& in_stop_token,
+                         RkSize                   in_max_rounds = std::numeric_limits<RkSize>::max(),
+                         Clock::time_point        in_deadline   = Clock::time_point::max()) noexcept;
+
+        /**
+         * \brief Sets the priority of the queue, used when the queue has no explicit deadline
+         * \param in_priority Priority of the queue, higher values are served first
+         */
+        RkVoid SetPriority(RkUint8 in_priority) noexcept;
+
+        /**
+         * \brief Returns the priority of the queue
+         * \return Priority
+         */
+        [[nodiscard]]
+        RkUint8 GetPriority() const noexcept;
+
+        /**
+         * \brief Sets an explicit deadline, the queue is served before any queue with a later deadline
+         *        and jobs dequeued past this deadline are counted as missed.
+         * \param in_deadline Deadline of the jobs of the queue, usually the end of the current frame
+         */
+        RkVoid SetDeadline(Clock::time_point in_deadline) noexcept;
+
+        /**
+         * \brief Removes the explicit deadline of the queue, its priority is used instead
          */
-        RkVoid PopAndRun(RkBool in_sticky, std::stop_token const& in_stop_token) noexcept;
+        RkVoid ClearDeadline() noexcept;
+
+        /**
+         * \brief Returns the deadline the queue is ordered by.
+         *        This is either the explicit deadline of the queue or the one derived from its priority,
+         *        relative to the last time the queue has been served.
+         * \return Effective deadline
+         */
+        [[nodiscard]]
+        Clock::time_point GetEffectiveDeadline() const noexcept;
+
+        /**
+         * \brief Returns the number of jobs dequeued after the explicit deadline of the queue since its creation
+         * \return Missed deadline count
+         */
+        [[nodiscard]]
+        RkSize GetMissedDeadlineCount() const noexcept;
 
         /**
          * \brief Returns the concurrency counter of the queue. This value cannot be used for any kind of synchronization.
@@ -100,6 +222,50 @@ class CentralProcessingQueue: public ProcessingQueue<CentralProcessingUnit>
         [[nodiscard]]
         ConcurrencyCounter GetConcurrencyCounter() const noexcept;
 
+        /**
+         * \brief Returns the amount of pushes that exceeded the capacity of the queue since its creation.
+         *        A steadily increasing value means that the queue should be made larger.
+         * \return Overflow count
+         */
+        [[nodiscard]]
+        RkSize GetOverflowCount() const noexcept;
+
+        /**
+         * \brief Returns the number of jobs run from this queue since its creation
+         * \return Executed job count
+         */
+        [[nodiscard]]
+        RkUint64 GetExecutedJobCount() const noexcept;
+
+        /**
+         * \brief Returns the number of dequeue attempts that timed out on an empty queue since its creation.
+         *        A high value relative to the executed job count means that too many workers are polling the queue.
+         * \return Empty poll count
+         */
+        [[nodiscard]]
+        RkUint64 GetEmptyPollCount() const noexcept;
+
+        /**
+         * \brief Returns the number of jobs currently waiting in the queue, overflowed ones included
+         * \return Depth of the queue
+         */
+        [[nodiscard]]
+        RkSize GetDepth() const noexcept;
+
+        /**
+         * \brief Returns the largest number of jobs that have been waiting in the queue at once since its creation
+         * \return Depth high water mark
+         */
+        [[nodiscard]]
+        RkSize GetDepthHighWaterMark() const noexcept;
+
+        /**
+         * \brief Returns the capacity of the ring buffer of the queue, excluding the overflow list.
+         * \return Capacity of the queue
+         */
+        [[nodiscard]]
+        RkSize GetCapacity() const noexcept;
+
         // TODO constrained version
         [[nodiscard]]
         RkFloat ComputeOptimalConcurrency(RkUint32 in_max_concurrency) const noexcept;
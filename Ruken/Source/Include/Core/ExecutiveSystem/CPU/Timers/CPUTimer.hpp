@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/CPUAwaiter.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Intrusive node of the timer wheel.
+ *        The owner is notified once the deadline has been reached.
+ */
+struct CPUTimer
+{
+    #pragma region Members
+
+    CPUAwaiter* owner    {nullptr};
+    CPUTimer*   next     {nullptr};
+    RkUint64    deadline {0ULL}; // In ticks since the creation of the timer wheel
+
+    #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
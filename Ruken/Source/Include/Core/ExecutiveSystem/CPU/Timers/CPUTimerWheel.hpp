@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Timers/CPUTimer.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Hierarchical timer wheel of the central processing unit.
+ *
+ * Timers can be armed from any thread and are stored into a lock-free pending list.
+ * The wheel itself is serviced by the workers (see Worker::ProcessQueues), only one of them at a time,
+ * which moves pending timers into the wheel and notifies the owners of the expired ones.
+ *
+ * The wheel has a resolution of 1 tick (1 millisecond) and is made of 4 levels of 64 slots, covering
+ * a bit more than 4 hours. Timers further than that are parked into the last slot and re-inserted when it cascades.
+ */
+class CPUTimerWheel
+{
+    public:
+
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = Clock::time_point;
+        using Tick      = std::chrono::milliseconds;
+
+    private:
+
+        static constexpr RkSize level_bits  {6ULL};
+        static constexpr RkSize level_size  {1ULL << level_bits};
+        static constexpr RkSize level_count {4ULL};
+
+        #pragma region Members
+
+        TimePoint const                                                 m_origin    {Clock::now()};
+        std::atomic<CPUTimer*>                                          m_pending   {nullptr};
+        std::atomic<RkSize>                                             m_armed     {0ULL};
+        std::atomic<RkBool>                                             m_servicing {false};
+        std::atomic<RkUint64>                                           m_next      {0ULL}; ///< Lower bound of the next expiry, in ticks
+        RkUint64                                                        m_current   {0ULL};
+        std::array<std::array<CPUTimer*, level_size>, level_count>      m_slots     {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Inserts a timer into the wheel or into the expired list if its deadline has already been reached
+         * \param in_timer Timer to insert
+         * \param inout_expired Expired list
+         */
+        RkVoid Insert(CPUTimer* in_timer, CPUTimer*& inout_expired) noexcept;
+
+        /**
+         * \brief Re-inserts every timer of a slot, moving them to lower levels
+         * \param in_level Level of the slot
+         * \param inout_expired Expired list
+         */
+        RkVoid Cascade(RkSize in_level, CPUTimer*& inout_expired) noexcept;
+
+        /**
+         * \brief Checks if no timer is stored in any slot of a level
+         * \param in_level Level to check
+         * \return True if the level is empty, false otherwise
+         */
+        [[nodiscard]]
+        RkBool IsLevelEmpty(RkSize in_level) const noexcept;
+
+        /**
+         * \brief Computes the earliest tick at which a timer stored in the wheel can expire or cascade
+         * \return Next expiry, in ticks
+         */
+        [[nodiscard]]
+        RkUint64 ComputeNextExpiry() const noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        CPUTimerWheel()                     = default;
+        CPUTimerWheel(CPUTimerWheel const&) = delete;
+        CPUTimerWheel(CPUTimerWheel&&)      = delete;
+        ~CPUTimerWheel()                    = default;
+
+        CPUTimerWheel& operator=(CPUTimerWheel const&) = delete;
+        CPUTimerWheel& operator=(CPUTimerWheel&&)      = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the timer wheel instance
+         * \return Timer wheel instance
+         */
+        static CPUTimerWheel& GetInstance() noexcept;
+
+        /**
+         * \brief Converts a time point into a deadline in ticks of the wheel, rounded up
+         * \param in_time_point Time point to convert
+         * \return Deadline
+         */
+        [[nodiscard]]
+        RkUint64 ToDeadline(TimePoint in_time_point) const noexcept;
+
+        /**
+         * \brief Arms a timer. Its owner will be notified once by a worker servicing the wheel when the deadline is reached.
+         * \note The timer must stay alive until its owner has been notified.
+         * \param in_timer Timer to arm, its owner and deadline must be set.
+         */
+        RkVoid Arm(CPUTimer& in_timer) noexcept;
+
+        /**
+         * \brief Advances the wheel up to the current time and notifies the owners of every expired timer.
+         *        This function is a no-op if no timer is armed or if another thread is already servicing the wheel.
+         */
+        RkVoid Process() noexcept;
+
+        /**
+         * \brief Returns the time point at which the wheel should be serviced again at the latest.
+         *        This is used by the parked workers to wake up in time, see CPUParkingLot.
+         * \return Next expiry, time_point::min() if freshly armed timers are waiting to be inserted,
+         *         time_point::max() if no timer is armed
+         */
+        [[nodiscard]]
+        TimePoint GetNextExpiry() const noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Kinds of events recorded by the task tracer
+ *
+ * Spawn              => A task has been created and pushed to its queue
+ * Resume             => A worker is about to resume a task
+ * Suspend            => A task returned control to the worker (suspension or completion)
+ * Complete           => A task reached its final suspension point
+ * Transfer           => A completed task resumes one of its continuations in place (symmetric transfer)
+ * ProcessQueuesBegin => A worker starts processing its queues
+ * ProcessQueuesEnd   => A worker is done processing its queues
+ * PopAndRunBegin     => A worker joined a queue to consume its jobs
+ * PopAndRunEnd       => A worker left a queue
+ */
+enum class ETaskTraceEvent : RkUint8
+{
+    Spawn,
+    Resume,
+    Suspend,
+    Complete,
+    Transfer,
+    ProcessQueuesBegin,
+    ProcessQueuesEnd,
+    PopAndRunBegin,
+    PopAndRunEnd
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <ostream>
+#include <filesystem>
+
+#include "Build/Config.hpp"
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Tracing/ETaskTraceEvent.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Records task events of the executive system and exports them as a chrome trace.
+ *
+ * Each thread records its events into its own lock-free ring buffer, timestamped using the TSC.
+ * The resulting trace can be opened with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * \note Recording is only compiled in when RUKEN_TASK_TRACING_ENABLED is defined (see Build/Config.hpp).
+ *       Use the RUKEN_TRACE_TASK_EVENT macro instead of calling Record directly, this way
+ *       no code at all is generated when tracing is disabled.
+ */
+class TaskTracer
+{
+    public:
+
+        #pragma region Methods
+
+        #if defined(RUKEN_TASK_TRACING_ENABLED)
+
+        /**
+         * \brief Records an event into the ring buffer of the calling thread
+         * \param in_event Recorded event
+         * \param in_task Address of the task's coroutine frame, if any
+         * \param in_queue Address of the queue the event relates to, if any
+         */
+        static RkVoid Record(ETaskTraceEvent in_event, RkVoid const* in_task, RkVoid const* in_queue) noexcept;
+
+        #endif
+
+        /**
+         * \brief Writes every recorded event using the chrome trace event JSON format.
+         *        Writes an empty trace if tracing has been compiled out.
+         * \note Events recorded while dumping might be missing or partially overwritten,
+         *       for best results this should be called while the executive system is idle.
+         * \param inout_stream Output stream
+         */
+        static RkVoid DumpChromeTrace(std::ostream& inout_stream);
+
+        /**
+         * \brief Writes every recorded event into a chrome trace JSON file
+         * \param in_path Path of the file to write
+         * \return True if the file could be written, false otherwise
+         */
+        static RkBool DumpChromeTrace(std::filesystem::path const& in_path);
+
+        #pragma endregion
+};
+
+/**
+ * \brief Records a task event
+ * \param in_event ETaskTraceEvent value
+ * \param in_task Address of the task's coroutine frame, if any
+ * \param in_queue Address of the queue the event relates to, if any
+ * \note This macro will automatically optimize out calls if task tracing has been disabled in build
+ */
+#if defined(RUKEN_TASK_TRACING_ENABLED)
+    #define RUKEN_TRACE_TASK_EVENT(in_event, in_task, in_queue) ::RUKEN_NAMESPACE::TaskTracer::Record(in_event, in_task, in_queue)
+#else
+    #define RUKEN_TRACE_TASK_EVENT(in_event, in_task, in_queue)
+#endif
+
+END_RUKEN_NAMESPACE
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "Types/FundamentalTypes.hpp"
+#include "Core/ExecutiveSystem/CPU/Metrics/WorkerMetrics.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
@@ -17,7 +21,8 @@ class Worker
 	#pragma region Members
 
     std::vector<CentralProcessingQueue*>& m_queues;
-    std::jthread                          m_thread {};
+    WorkerMetrics                         m_metrics {};
+    std::jthread                          m_thread  {};
 
     #pragma endregion
 
@@ -28,7 +33,7 @@ class Worker
      * \param in_stop_token Stop token, automatically requested by the thread upon destruction
      * \param in_name Name of the worker thread
      */
-    RkVoid Routine(std::stop_token&& in_stop_token, std::string&& in_name) const noexcept;
+    RkVoid Routine(std::stop_token&& in_stop_token, std::string&& in_name) noexcept;
 
     #pragma endregion
 
@@ -55,8 +60,41 @@ class Worker
          * \brief Runs jobs on the passed queues for a maximum of one full cycle.
          * \param in_queues Queues to cycle though 
          * \param in_stop_token If a stop is requested, the method will return as soon as the current job is done
+         * \param in_deadline Once reached, the method will return as soon as the current job is done
+         * \return Number of jobs run during the cycle
          */
-        static RkVoid ProcessQueues(std::vector<CentralProcessingQueue*> const& in_queues, std::stop_token const& in_stop_token) noexcept;
+        static RkSize ProcessQueues(std::vector<CentralProcessingQueue*> const& in_queues,
+                                    std::stop_token                      const& in_stop_token,
+                                    std::chrono::steady_clock::time_point       in_deadline = std::chrono::steady_clock::time_point::max()) noexcept;
+
+        /**
+         * \brief Called after every cycle that did not run any job, parks the calling thread
+         *        once RUKEN_CPU_WORKER_IDLE_CYCLES consecutive cycles have been idle (see CPUParkingLot::Park).
+         * \param in_queues Queues processed by the calling thread
+         * \param in_stop_token Stop token of the calling thread
+         * \param inout_idle_cycles Number of consecutive idle cycles, to be reset by the caller once a job has been run
+         * \param in_counter Optional counter, the calling thread is woken up once it reaches 0
+         * \param in_deadline The calling thread is woken up at this time point at the latest
+         */
+        static RkVoid Idle(std::vector<CentralProcessingQueue*> const& in_queues,
+                           std::stop_token                      const& in_stop_token,
+                           RkSize&                                     inout_idle_cycles,
+                           std::atomic<RkSize>                  const* in_counter  = nullptr,
+                           std::chrono::steady_clock::time_point       in_deadline = std::chrono::steady_clock::time_point::max()) noexcept;
+
+        /**
+         * \brief Returns the runtime counters of the worker
+         * \return Worker metrics
+         */
+        [[nodiscard]]
+        WorkerMetrics const& GetMetrics() const noexcept;
+
+        /**
+         * \brief Returns the identifier of the worker thread
+         * \return Thread identifier
+         */
+        [[nodiscard]]
+        std::thread::id GetId() const noexcept;
 
         #pragma endregion
 
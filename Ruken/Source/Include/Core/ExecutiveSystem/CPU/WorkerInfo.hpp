@@ -1,11 +1,15 @@
 #pragma once
 
 #include <string>
+#include <coroutine>
 
 #include "Core/ExecutiveSystem/CPU/Queues/CentralProcessingQueue.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
+class CPUSpawnBatch;
+struct WorkerMetrics;
+
 /**
  * Globally accessible worker info.
  * This interface is accessible via any thread (even non-worker ones) and allows
@@ -17,6 +21,13 @@ struct WorkerInfo
 
     inline static thread_local std::string             name          {"Unnamed worker"};
     inline static thread_local CentralProcessingQueue* current_queue {nullptr};
+    inline static thread_local CPUSpawnBatch*          spawn_batch   {nullptr}; ///< Batch deferring the tasks spawned by this thread, if any
+    inline static thread_local WorkerMetrics*          metrics       {nullptr}; ///< Counters of the thread, nothing is counted if null
+
+    // Symmetric transfer state, see CPUTaskPromise::final_suspend
+    inline static thread_local std::coroutine_handle<> transfer_continuation {};      ///< Continuation claimed by the completing task
+    inline static thread_local RkSize                  transfer_depth        {0ULL};  ///< Continuations resumed in place since the last dequeued job
+    inline static thread_local RkBool                  transfer_allowed      {false}; ///< Whether a continuation can currently be claimed
 
     #pragma endregion
 };
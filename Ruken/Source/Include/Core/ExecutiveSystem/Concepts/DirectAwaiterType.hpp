@@ -0,0 +1,26 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+#include "Core/ExecutiveSystem/Concepts/AwaitableType.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Checks if the passed type is a direct awaiter of the passed processing unit.
+ *
+ * Direct awaiters implement the coroutine awaiter interface themselves instead of going through
+ * an awaitable bridge. Their await_suspend method receives the handle of the suspended coroutine, whose promise
+ * is the awaiter that must be notified (see CPUAwaiter::OnAwaitedContinuation) to resume the coroutine on its own queue.
+ */
+template <typename TType, typename TProcessingUnit>
+concept DirectAwaiterType = !AwaitableType<TType> &&
+    std::is_same_v<typename std::decay_t<TType>::ProcessingUnit, TProcessingUnit> &&
+    requires(std::decay_t<TType>& in_awaiter)
+    {
+        { in_awaiter.await_ready() } -> std::convertible_to<bool>;
+        in_awaiter.await_resume();
+    };
+
+END_RUKEN_NAMESPACE
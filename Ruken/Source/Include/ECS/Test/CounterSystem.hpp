@@ -1,6 +1,8 @@
 #pragma once
 
-#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/CountDownLatch.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/WhenAll.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUDynamicTask.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CPUSpawnBatch.hpp"
 
 #include "ECS/System.hpp"
 #include "ECS/EventHandler.hpp"
@@ -8,28 +10,6 @@
 
 USING_RUKEN_NAMESPACE
 
-inline CPUDynamicTask<> WhenAll(std::vector<CPUDynamicTask<>> const& in_jobs)
-{
-    CountDownLatch               latch         {in_jobs.size()};
-    std::vector<CPUContinuation> continuations {in_jobs.size()};
-
-    for (RkSize index = 0; index < in_jobs.size(); ++index)
-    {
-        // Creating a job and keeping a reference onto it until the attachment
-        // process has been done to avoid it being deleted in the meanwhile.
-
-        // Instantiating the job and setup the continuation callback
-        continuations[index].Setup(latch, in_jobs[index]);
-
-        // Trying to attach the continuation and if the process failed, that means the event we
-        // were looking to await has already been completed. Thus we need to decrement manually the latch by one.
-        if (!continuations[index].TryAttach())
-            latch.CountDown();
-    }
-
-    co_await latch;
-}
-
 struct CounterSystem final: public System
 {
     CounterSystem(EntityAdmin& in_admin) : System(in_admin)
@@ -70,15 +50,21 @@ struct CounterSystem final: public System
 
             std::vector<CPUDynamicTask<RkVoid>> tasks {task_count};
             RkSize index {0};
-            for (auto const& archetype: m_archetypes)
-            {
-                auto& container = archetype.get()
-                        .GetComponent     <CounterComponent>            ()
-                        .GetFieldContainer<CounterComponent::CountField>();
 
-                using Container = std::remove_reference_t<decltype(container)>;
-                for (Container::Node* current_node = container.GetHead(); current_node != nullptr; current_node = current_node->next_node)
-                    tasks[index++] = ProcessChunk(*current_node);
+            // Every chunk task is pushed at once when the batch goes out of scope
+            {
+                CPUSpawnBatch batch {task_count};
+
+                for (auto const& archetype: m_archetypes)
+                {
+                    auto& container = archetype.get()
+                            .GetComponent     <CounterComponent>            ()
+                            .GetFieldContainer<CounterComponent::CountField>();
+
+                    using Container = std::remove_reference_t<decltype(container)>;
+                    for (Container::Node* current_node = container.GetHead(); current_node != nullptr; current_node = current_node->next_node)
+                        tasks[index++] = ProcessChunk(*current_node);
+                }
             }
 
             co_await WhenAll(tasks);
@@ -32,7 +32,7 @@ class Handle
 
         #pragma region Variables
         
-        ResourceManifest* m_manifest;
+        ResourceManifest* m_manifest {nullptr};
 
         #pragma endregion
 
@@ -3,11 +3,16 @@
 
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
+#include "Threading/Scheduler.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUTask.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
 /**
  * \brief Base resource interface. Allows the implementation of any type of resource.
+ *
+ * Loading and reloading are coroutines executed on the SchedulerQueue, blocking operations
+ * such as file reads must be awaited (see AsyncReadFile) instead of stalling the worker.
  * \see ResourceManager class
  * \see BaseResourceLoadingDescriptor class
  */
@@ -35,8 +40,9 @@ class IResource
          * 
          * \param in_manager Resource manager instance. This is useful to request dependencies or resolve assets name/path.
          * \param in_descriptor Resource loading descriptor. This structure can be inherited to pass custom parameters to the loader
+         * \return Loading task, the descriptor stays alive until its completion
          */
-        virtual RkVoid Load(class ResourceManager& in_manager, class ResourceLoadingDescriptor const& in_descriptor) = 0;
+        virtual CPUTask<SchedulerQueue> Load(class ResourceManager& in_manager, class ResourceLoadingDescriptor const& in_descriptor) = 0;
         
         /**
          * \brief Reloads the resource
@@ -48,8 +54,9 @@ class IResource
          * This will be called only if load() has successfully be called before
          * 
          * \param in_manager Resource manager instance. This is useful to request dependencies or resolve assets name/path.
+         * \return Reloading task
          */
-        virtual RkVoid Reload(class ResourceManager& in_manager) = 0;
+        virtual CPUTask<SchedulerQueue> Reload(class ResourceManager& in_manager) = 0;
         
         /**
          * \brief Unloads the resource
@@ -1,7 +1,7 @@
-
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
@@ -12,52 +12,99 @@ BEGIN_RUKEN_NAMESPACE
  * \brief Resource Identifier class
  * 
  * A resource identifier is a unique key allowing the identification of a resource.
- * This key is hash-able for fast unordered map access.
+ * Identifiers are interned: only a 64 bits hash of the resource path is kept (see ResourceIdentifierPool),
+ * which makes identifiers trivially copyable, and their comparison and hashing O(1).
+ *
+ * Identifiers of paths known at compile time can be computed at compile time as well:
+ * \code
+ * Handle<Texture> texture {manager.RequestResource<Texture>("Textures/Brick.png"_rid, descriptor)};
+ * \endcode
+ *
+ * \note Paths are only kept by debug builds (see RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER), for debug messages.
  */
 struct ResourceIdentifier
 {
     #pragma region Variables
 
-    std::string name;
+    // Hash of the path of the resource, 0 is reserved for invalid identifiers
+    RkUint64 id {0ULL};
 
     #pragma endregion
 
     #pragma region Constructors
 
-    ResourceIdentifier(std::string const& in_name)              noexcept;
-    ResourceIdentifier(ResourceIdentifier const& in_copy) noexcept;
-    ResourceIdentifier(ResourceIdentifier&&         in_move) noexcept;
-    ~ResourceIdentifier() = default;
+    constexpr ResourceIdentifier() noexcept = default;
+
+    /**
+     * \brief Interns the path of a resource
+     * \param in_name Path of the resource
+     */
+    ResourceIdentifier(std::string_view in_name) noexcept;
+
+    constexpr ResourceIdentifier(ResourceIdentifier const& in_copy) noexcept = default;
+    constexpr ResourceIdentifier(ResourceIdentifier&&      in_move) noexcept = default;
+    constexpr ~ResourceIdentifier()                                          = default;
 	
     #pragma endregion
 
+    #pragma region Methods
+
+    /**
+     * \brief Computes the identifier of a path, this is a 64 bits FNV-1a hash
+     * \param in_name Path of the resource
+     * \return Identifier of the path, never 0
+     */
+    [[nodiscard]]
+    static constexpr RkUint64 Hash(std::string_view in_name) noexcept;
+
+    /**
+     * \brief Creates an identifier from its hash, without interning anything
+     * \param in_id Hash of the path of the resource, see Hash
+     * \return Resource identifier
+     */
+    [[nodiscard]]
+    static constexpr ResourceIdentifier FromId(RkUint64 in_id) noexcept;
+
+    #pragma endregion
+
     #pragma region Operators
 
     /**
     * \brief Converts the ResourceIdentifier to a string representation
-    * \return std::string representation
+    * \return Path of the resource if it is known by the ResourceIdentifierPool, the hexadecimal identifier otherwise
     */
     explicit operator std::string() const noexcept;
 
-    ResourceIdentifier& operator=(ResourceIdentifier const& in_copy) noexcept;
-    ResourceIdentifier& operator=(ResourceIdentifier&&        in_move) noexcept;
+    constexpr ResourceIdentifier& operator=(ResourceIdentifier const& in_copy) noexcept = default;
+    constexpr ResourceIdentifier& operator=(ResourceIdentifier&&      in_move) noexcept = default;
 
-    RkBool operator==(ResourceIdentifier const& in_other) const noexcept;
+    constexpr RkBool operator==(ResourceIdentifier const& in_other) const noexcept = default;
 
     #pragma endregion
 };
 
+/**
+ * \brief Computes the identifier of a resource path at compile time
+ * \note Unlike runtime identifiers, the path is not kept by the ResourceIdentifierPool
+ * \param in_name Path of the resource
+ * \param in_length Length of the path
+ * \return Resource identifier
+ */
+consteval ResourceIdentifier operator"" _rid(RkChar const* in_name, RkSize in_length) noexcept;
+
+#include "Resource/ResourceIdentifier.inl"
+
 END_RUKEN_NAMESPACE
 
 namespace std
 {
-    // Hash support for ResourceIdentifier
+    // Hash support for ResourceIdentifier, the identifier already is a hash
     template<>
     struct hash<RUKEN_NAMESPACE::ResourceIdentifier> 
     {
         size_t operator()(RUKEN_NAMESPACE::ResourceIdentifier const& in_identifier) const noexcept
         {
-            return std::hash<std::string>()(in_identifier.name);
+            return static_cast<size_t>(in_identifier.id);
         }
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Build/Config.hpp"
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "Threading/Synchronized.hpp"
+#include "Threading/SynchronizedAccess.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Global pool of the resource identifiers, see ResourceIdentifier
+ *
+ * Interning a path returns its 64 bits identifier, which is stable: the same path always has the same identifier,
+ * whether it has been interned at runtime or computed at compile time with the _rid suffix.
+ *
+ * If RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER is defined (debug builds), the pool keeps the path of every interned identifier
+ * for debug messages, and reports hash collisions. Otherwise interning only hashes the path and nothing is stored.
+ *
+ * \warning Release builds cannot detect collisions: two paths sharing the same hash silently designate the same resource.
+ *          Builds defining RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER should be run over the content to catch them.
+ */
+class ResourceIdentifierPool
+{
+    private:
+
+        #if defined(RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER)
+
+        #pragma region Members
+
+        Synchronized<std::unordered_map<RkUint64, std::string>> m_names;
+
+        #pragma endregion
+
+        #endif
+
+    public:
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the pool instance
+         * \return Pool instance
+         */
+        static ResourceIdentifierPool& GetInstance() noexcept;
+
+        /**
+         * \brief Interns a resource path
+         * \param in_name Path of the resource
+         * \return Identifier of the path
+         */
+        [[nodiscard]]
+        RkUint64 Intern(std::string_view in_name) noexcept;
+
+        /**
+         * \brief Returns the path of an identifier
+         * \param in_id Identifier
+         * \return Interned path of the identifier, or its hexadecimal representation if the path is unknown or has not been kept
+         */
+        [[nodiscard]]
+        std::string GetName(RkUint64 in_id) noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -1,6 +1,9 @@
 
 #pragma once
 
+#include <concepts>
+#include <type_traits>
+
 #include "Build/Namespace.hpp"
 
 BEGIN_RUKEN_NAMESPACE
@@ -9,4 +12,11 @@ BEGIN_RUKEN_NAMESPACE
 class __declspec(novtable) ResourceLoadingDescriptor
 {};
 
+/**
+ * \brief Concrete loading descriptor type.
+ *        Asynchronous loads copy their descriptor, descriptors have to be final to be copied without slicing.
+ */
+template <typename TType>
+concept LoadingDescriptorType = std::derived_from<TType, ResourceLoadingDescriptor> && std::is_final_v<TType> && std::copy_constructible<TType>;
+
 END_RUKEN_NAMESPACE
\ No newline at end of file
@@ -2,7 +2,8 @@
 #pragma once
 
 #include <atomic>
-#include <unordered_map>
+#include <vector>
+#include <utility>
 
 #include "Build/Namespace.hpp"
 
@@ -11,12 +12,13 @@
 #include "Types/FundamentalTypes.hpp"
 
 #include "Threading/Scheduler.hpp"
-#include "Threading/Synchronized.hpp"
-#include "Threading/SynchronizedAccess.hpp"
+#include "Threading/EpochReclaimer.hpp"
 #include "Threading/ESynchronizationMode.hpp"
 
 #include "Resource/Handle.hpp"
 #include "Resource/ResourceIdentifier.hpp"
+#include "Resource/ResourceManifestTable.hpp"
+#include "Resource/ResourceLoadingDescriptor.hpp"
 #include "Resource/Enums/EGCCollectionMode.hpp"
 #include "Resource/Enums/EResourceGCStrategy.hpp"
 
@@ -28,8 +30,8 @@ class ResourceManager final: public Service<ResourceManager>
 
         #pragma region Variables
 
-        // Synchronized map of all the resource manifests
-        Synchronized<std::unordered_map<ResourceIdentifier, struct ResourceManifest*>> m_manifests;
+        // Concurrent map of all the resource manifests
+        ResourceManifestTable m_manifests;
 
         // Integrated garbage collection mode of the resource manager. 
         EGCCollectionMode m_collection_mode;
@@ -41,15 +43,26 @@ class ResourceManager final: public Service<ResourceManager>
 
         #pragma endregion
 
-        using ManifestsType        = decltype(m_manifests)::UnderlyingType;
-        using ManifestsReadAccess  = decltype(m_manifests)::ReadAccess;
-        using ManifestsWriteAccess = decltype(m_manifests)::WriteAccess;
-
         #pragma region Methods
 
-        RkVoid LoadingRoutine  (struct ResourceManifest* in_manifest, class ResourceLoadingDescriptor const& in_descriptor);
-        RkVoid ReloadingRoutine(struct ResourceManifest* in_manifest);
-        RkVoid UnloadingRoutine(struct ResourceManifest* in_manifest);
+        CPUTask<SchedulerQueue> LoadingRoutine  (struct ResourceManifest* in_manifest, class ResourceLoadingDescriptor const& in_descriptor);
+        CPUTask<SchedulerQueue> ReloadingRoutine(struct ResourceManifest* in_manifest);
+        RkVoid                  UnloadingRoutine(struct ResourceManifest* in_manifest);
+
+        /**
+         * \brief Asynchronously loads a resource, the descriptor is kept in the frame of the job until the loading is done
+         * \tparam TDescriptor Loading descriptor type, see RequestResource
+         * \param in_manifest Manifest of the resource to load
+         * \param in_descriptor Parameters to pass to the resource loader
+         */
+        template <LoadingDescriptorType TDescriptor>
+        CPUDetachedTask<SchedulerQueue> LoadingJob(struct ResourceManifest* in_manifest, TDescriptor in_descriptor);
+
+        /**
+         * \brief Asynchronously reloads a resource
+         * \param in_manifest Manifest of the resource to reload
+         */
+        CPUDetachedTask<SchedulerQueue> ReloadingJob(struct ResourceManifest* in_manifest);
 
         /**
          * \brief Invalidates a resource and tags it's corresponding resource manager for garbage collection.
@@ -58,10 +71,19 @@ class ResourceManager final: public Service<ResourceManager>
         RkVoid InvalidateResource(struct ResourceManifest* in_manifest) noexcept;
 
         /**
-         * \brief Finds or creates a resource manifest by name.
+         * \brief Retires a manifest claimed and removed from the table (see ResourceManifest::TryRetire),
+         *        it is deleted once no caller of RequestManifest nor any handle can be using it anymore.
+         *        Callers of RequestManifest must hold an EpochReclaimer::ReadGuard until they acquired a handle on the manifest.
+         * \param in_manifest Manifest to retire
+         */
+        static RkVoid RetireManifest(struct ResourceManifest* in_manifest) noexcept;
+
+        /**
+         * \brief Finds or creates a resource manifest by name. Lookups are lock free, see ResourceManifestTable.
          * \param in_unique_identifier Unique identifier of the resource.
          * \param in_auto_create_manifest If set to true, this method will automatically create a manifest and assign it to the passed identifier if none has been found.
-         * \return The requested manifest.
+         * \return The requested manifest, never a retired one.
+         * \warning The manifest can be claimed by a garbage collection as soon as it is returned, acquiring a handle on it might fail. See RetireManifest.
          */
         [[nodiscard]]
         struct ResourceManifest* RequestManifest(ResourceIdentifier const& in_unique_identifier, RkBool in_auto_create_manifest = true) noexcept;
@@ -70,7 +92,7 @@ class ResourceManager final: public Service<ResourceManager>
          * \brief Triggers a garbage collection
          * 
          * Iterates over every resource currently loaded and junks them if the
-         * passed predicate return true.
+         * passed predicate return true. The manifests are swept one shard at a time, without blocking lookups.
          * 
          * The signature of the predicate should be:
          * bool (*in_predicate)(ResourceManifest const& in_manifest)
@@ -86,11 +108,12 @@ class ResourceManager final: public Service<ResourceManager>
          * \brief Loads a resource
          * \tparam TResource_Type Resource type to load
          * \param in_manifest Manifest to put the resource into
-         * \param in_descriptor Parameters to pass to the resource loader
+         * \tparam TDescriptor Loading descriptor type, see RequestResource
+         * \param in_descriptor Parameters to pass to the resource loader, copied by asynchronous loads
          * \param in_loading_mode Loading mode of the resource (async/sync)
          */
-        template <typename TResource_Type>
-        RkVoid LoadResource(ResourceManifest* in_manifest, class ResourceLoadingDescriptor const& in_descriptor, ESynchronizationMode in_loading_mode) noexcept;
+        template <typename TResource_Type, LoadingDescriptorType TDescriptor>
+        RkVoid LoadResource(ResourceManifest* in_manifest, TDescriptor const& in_descriptor, ESynchronizationMode in_loading_mode) noexcept;
 
         /**
          * \brief Unloads all the currently loaded resources in the manager
@@ -180,13 +203,14 @@ class ResourceManager final: public Service<ResourceManager>
          * \brief Requests a resource from the resource manager.
          * 
          * \tparam TResource_Type Type of the resource to request
+         * \tparam TDescriptor Loading descriptor type, must be final since asynchronous loads copy it
          * \param in_unique_identifier Unique name of the resource, this identifier is the same whatever the type of the requested resource.
-         * \param in_descriptor Description of the resource
+         * \param in_descriptor Description of the resource, asynchronous loads work on a copy of it
          * \param in_loading_mode Resource loading mode. See ESynchronizationMode for more detailed information.
          * \return Handle to the resource
          */
-        template <typename TResource_Type>
-        Handle<TResource_Type> RequestResource(ResourceIdentifier const& in_unique_identifier, class ResourceLoadingDescriptor const& in_descriptor, ESynchronizationMode in_loading_mode = ESynchronizationMode::Asynchronous) noexcept;
+        template <typename TResource_Type, LoadingDescriptorType TDescriptor>
+        Handle<TResource_Type> RequestResource(ResourceIdentifier const& in_unique_identifier, TDescriptor const& in_descriptor, ESynchronizationMode in_loading_mode = ESynchronizationMode::Asynchronous) noexcept;
         
         /**
          * \brief Sets the garbage collection mode of the resource manager
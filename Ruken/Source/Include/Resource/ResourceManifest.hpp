@@ -9,10 +9,6 @@
 #include "Resource/Enums/EResourceGCStrategy.hpp"
 #include "Resource/ResourceIdentifier.hpp"
 
-#ifndef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
-    #define RUKEN_RESOURCE_MANIFEST_DONT_STORE_IDENTIFIER
-#endif
-
 BEGIN_RUKEN_NAMESPACE
 
 /**
@@ -28,29 +24,35 @@ BEGIN_RUKEN_NAMESPACE
  */
 struct ResourceManifest
 {
+    public:
+
+        typedef RkUint32 ReferenceCountType;
+
     private:
 
+        // Set once the manifest has been claimed for removal from the table, no handle can be acquired anymore
+        static constexpr ReferenceCountType retired_flag   {1U << 31U};
+
+        // Set once no lookup can reach the manifest anymore, the last handle released frees it
+        static constexpr ReferenceCountType reclaimed_flag {1U << 30U};
+
         #pragma region Members
 
-#ifdef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
-        // This is only used for debug messages
+        // Identifiers are interned and cheap to store, their path is only kept by debug builds (see ResourceIdentifierPool)
         const ResourceIdentifier m_identifier;
-#endif
+
+        // Number of handles referencing the resource, combined with the retirement flags above
+        std::atomic<ReferenceCountType> m_reference_count;
 
         #pragma endregion
 
     public:
 
-        typedef RkUint32 ReferenceCountType;
-
         #pragma region Members
 
         // Pointer to the resource itself
         std::atomic<class IResource*> data;
 
-        // Number of references to the resource
-        std::atomic<ReferenceCountType> reference_count;
-
         // Garbage collection (GC) strategy of the resource
         std::atomic<EResourceGCStrategy> gc_strategy;
 
@@ -74,14 +76,53 @@ struct ResourceManifest
         #pragma region Methods 
 
         /**
-         * \brief Returns the identifier of the manifest, if RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER isn't defined, this will return a default identifier instead
+         * \brief Returns the identifier of the manifest
          * \return Resource identifier
          */
-#ifdef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
-        [[nodiscard]] ResourceIdentifier const& GetIdentifier() const noexcept;
-#else
-        [[nodiscard]] ResourceIdentifier        GetIdentifier() const noexcept;
-#endif
+        [[nodiscard]] ResourceIdentifier GetIdentifier() const noexcept;
+
+        /**
+         * \brief Returns the number of handles referencing the resource
+         * \return Reference count
+         */
+        [[nodiscard]] ReferenceCountType GetReferenceCount() const noexcept;
+
+        /**
+         * \brief Checks if the manifest has been claimed for removal, see TryRetire
+         * \return True if the manifest is retired, false otherwise
+         */
+        [[nodiscard]] RkBool IsRetired() const noexcept;
+
+        /**
+         * \brief Acquires a new reference to a manifest found in the table
+         * \return False if the manifest has been retired in the meantime, in which case no reference has been acquired
+         */
+        [[nodiscard]] RkBool TryAcquire() noexcept;
+
+        /**
+         * \brief Acquires an additional reference, the caller must already hold one
+         */
+        RkVoid AddReference() noexcept;
+
+        /**
+         * \brief Releases a reference, the manifest is freed if it was the last reference of a reclaimed manifest
+         * \warning The manifest must not be accessed after this call
+         */
+        RkVoid Release() noexcept;
+
+        /**
+         * \brief Claims the manifest for its removal from the table, no handle can be acquired once it succeeded
+         * \param in_force If set to true, the manifest is retired even though handles still reference it. These handles keep it alive.
+         * \return True if the manifest is retired, false if it is referenced and in_force is not set
+         */
+        RkBool TryRetire(RkBool in_force = false) noexcept;
+
+        /**
+         * \brief Called once no lookup can reach a retired manifest anymore, see ResourceManager::RetireManifest.
+         *        The manifest is freed right away if it is not referenced, by its last handle otherwise.
+         * \warning The manifest must not be accessed after this call
+         */
+        RkVoid Reclaim() noexcept;
 
         #pragma endregion 
 
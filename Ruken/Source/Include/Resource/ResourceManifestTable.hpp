@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "Threading/SynchronizedRcu.hpp"
+
+#include "Resource/ResourceIdentifier.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+struct ResourceManifest;
+
+/**
+ * \brief Concurrent map of the resource manifests, used by the resource manager
+ *
+ * The table is split into shards, selected by the hash of the identifier.
+ * Each shard is a read-copy-update map (see SynchronizedRcu):
+ *  - Lookups never take any lock, and are never blocked by inserts nor sweeps.
+ *  - Inserts only lock and copy the shard of the identifier, inserts targeting different shards run in parallel.
+ *  - Sweeps walk the table one shard at a time, lookups keep seeing the previous version of the swept shard until it is done.
+ *    Shards with nothing to remove are neither copied nor published.
+ *
+ * \note The table does not own the manifests. A manifest removed by a sweep might still be in use by a concurrent lookup,
+ *       and must be retired through the EpochReclaimer rather than deleted.
+ */
+class ResourceManifestTable
+{
+    public:
+
+        // Shards are keyed by the interned id of the identifiers, which already is a hash
+        using ShardType = std::unordered_map<RkUint64, ResourceManifest*>;
+
+        // Number of shards, must be a power of two
+        static constexpr RkSize shard_count {64ULL};
+
+    private:
+
+        /**
+         * \brief Shard of the table, aligned to avoid any false sharing between shards
+         */
+        struct alignas(64) Shard
+        {
+            SynchronizedRcu<ShardType> manifests {};
+        };
+
+        #pragma region Members
+
+        std::array<Shard, shard_count> m_shards {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the shard of the passed identifier
+         * \param in_identifier Identifier of the resource
+         * \return Shard of the identifier
+         */
+        [[nodiscard]]
+        Shard& GetShard(ResourceIdentifier const& in_identifier) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        ResourceManifestTable()                             = default;
+        ResourceManifestTable(ResourceManifestTable const&) = delete;
+        ResourceManifestTable(ResourceManifestTable&&     ) = delete;
+        ~ResourceManifestTable()                            = default;
+
+        ResourceManifestTable& operator=(ResourceManifestTable const&) = delete;
+        ResourceManifestTable& operator=(ResourceManifestTable&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Looks for the manifest of a resource, lock free
+         * \param in_identifier Identifier of the resource
+         * \return Manifest of the resource, nullptr if none has been found
+         */
+        [[nodiscard]]
+        ResourceManifest* Find(ResourceIdentifier const& in_identifier) noexcept;
+
+        /**
+         * \brief Inserts a manifest, unless the identifier already has one
+         * \param in_identifier Identifier of the resource
+         * \param in_manifest Manifest to insert
+         * \return The manifest of the identifier: in_manifest if it has been inserted, the already existing manifest otherwise
+         */
+        ResourceManifest* Insert(ResourceIdentifier const& in_identifier, ResourceManifest* in_manifest) noexcept;
+
+        /**
+         * \brief Visits every manifest of the table, lock free
+         *
+         * The signature of the visitor should be:
+         * void (*in_visitor)(ResourceManifest* in_manifest)
+         *
+         * \tparam TVisitor Type of the visitor
+         * \param in_visitor Visitor
+         */
+        template <typename TVisitor>
+        RkVoid ForEach(TVisitor in_visitor) noexcept;
+
+        /**
+         * \brief Removes the manifests matching a predicate, one shard at a time.
+         *        Shards are scanned without any lock first, only the shards containing matching manifests are copied and published.
+         *
+         * The signature of the predicate should be:
+         * bool (*in_predicate)(ResourceManifest& in_manifest), returning true to remove the manifest from the table.
+         *
+         * \tparam TPredicate Type of the predicate
+         * \param in_predicate Predicate, might be called more than once per manifest.
+         *                     Once it returned true for a manifest, it must keep doing so (see ResourceManifest::TryRetire).
+         * \param out_removed Receives the removed manifests
+         * \note The predicate is first called without any lock, concurrently with lookups and inserts, then again while the shard is locked.
+         *       It must not access the table.
+         */
+        template <typename TPredicate>
+        RkVoid Sweep(TPredicate in_predicate, std::vector<ResourceManifest*>& out_removed) noexcept;
+
+        #pragma endregion
+};
+
+#include "Resource/ResourceManifestTable.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Epoch based memory reclamation, used by SynchronizedRcu.
+ *
+ * Readers enter a critical section by announcing the current global epoch, this is a single store
+ * to a cache line owned by the calling thread, and leave it by clearing their announcement.
+ * Writers unlink an object, then retire it: the global epoch is advanced and the object is tagged with the new epoch.
+ * Any reader that could still see the object announced an older epoch, the object is destroyed
+ * once every announced epoch is at least as recent as its tag.
+ *
+ * Reclamation is done by the writers while retiring objects, readers never wait nor reclaim anything.
+ *
+ * \note Critical sections can be nested, only the outermost one is announced.
+ */
+class EpochReclaimer
+{
+    public:
+
+        using Deleter = RkVoid(*)(RkVoid*) noexcept;
+
+        /**
+         * \brief Scoped read critical section, objects loaded in this scope stay alive until it is left
+         */
+        class ReadGuard
+        {
+            public:
+
+                #pragma region Lifetime
+
+                ReadGuard() noexcept;
+                ReadGuard(ReadGuard const&) = delete;
+                ReadGuard(ReadGuard&&     ) = delete;
+                ~ReadGuard() noexcept;
+
+                ReadGuard& operator=(ReadGuard const&) = delete;
+                ReadGuard& operator=(ReadGuard&&     ) = delete;
+
+                #pragma endregion
+        };
+
+    private:
+
+        /**
+         * \brief Announcement of a thread, aligned to avoid any false sharing between readers
+         */
+        struct alignas(64) ThreadRecord
+        {
+            std::atomic<RkUint64> epoch {0ULL}; ///< Announced epoch, 0 while the thread is outside of any critical section
+            RkSize                depth {0ULL}; ///< Nesting depth of the critical sections, only accessed by the owning thread
+        };
+
+        /**
+         * \brief Registers the record of the calling thread for its whole lifetime
+         */
+        struct ThreadRegistration
+        {
+            ThreadRecord record {};
+
+            ThreadRegistration() noexcept;
+            ~ThreadRegistration() noexcept;
+        };
+
+        /**
+         * \brief Object waiting for the readers to move past its epoch
+         */
+        struct RetiredObject
+        {
+            RkVoid*  object;
+            Deleter  deleter;
+            RkUint64 epoch;
+        };
+
+        #pragma region Members
+
+        std::atomic<RkUint64>      m_epoch   {1ULL}; // 0 is reserved for threads outside of any critical section
+        std::mutex                 m_mutex   {};
+        std::vector<ThreadRecord*> m_records {};
+        std::vector<RetiredObject> m_retired {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the record of the calling thread, registering it on first use
+         * \return Thread record
+         */
+        static ThreadRecord& GetThreadRecord() noexcept;
+
+        /**
+         * \brief Destroys every retired object that cannot be reached by any reader anymore
+         * \note The mutex must be held by the caller.
+         */
+        RkVoid Reclaim() noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Lifetime
+
+        EpochReclaimer()                      = default;
+        EpochReclaimer(EpochReclaimer const&) = delete;
+        EpochReclaimer(EpochReclaimer&&     ) = delete;
+        ~EpochReclaimer() noexcept;
+
+        EpochReclaimer& operator=(EpochReclaimer const&) = delete;
+        EpochReclaimer& operator=(EpochReclaimer&&     ) = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the reclaimer instance
+         * \return Reclaimer instance
+         */
+        static EpochReclaimer& GetInstance() noexcept;
+
+        /**
+         * \brief Retires an object that has already been unlinked, it is destroyed once no reader can access it anymore
+         * \param in_object Object to retire
+         * \param in_deleter Function destroying the object
+         */
+        RkVoid Retire(RkVoid* in_object, Deleter in_deleter) noexcept;
+
+        /**
+         * \brief Retires an object allocated with new, see Retire
+         * \tparam TType Type of the object
+         * \param in_object Object to retire
+         */
+        template <typename TType>
+        RkVoid RetireObject(TType* in_object) noexcept
+        { Retire(in_object, [](RkVoid* in_pointer) noexcept { delete static_cast<TType*>(in_pointer); }); }
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -1,6 +1,8 @@
 ﻿
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include "Threading/Job.hpp"
@@ -11,18 +13,82 @@ BEGIN_RUKEN_NAMESPACE
 
 class Scheduler;
 
+/**
+ * \brief Directed acyclic graph of instructions.
+ *
+ * Instructions are released as soon as all of their predecessors are done, no worker ever waits on another instruction.
+ * Whenever several instructions are ready, the ones on the critical path (ie. with the longest remaining chain
+ * of instructions, weighted by their cost) are scheduled first.
+ *
+ * Dependencies can either be added explicitly, or implicitly by using instruction packs:
+ * every instruction depends on all the instructions of the previously ended pack.
+ *
+ * \code
+ * ExecutionPlan plan;
+ *
+ * ExecutionPlan::NodeId const input   {plan.AddInstruction([&] { input.Update();   })};
+ * ExecutionPlan::NodeId const physics {plan.AddInstruction([&] { physics.Update(); }, 4ULL)};
+ * ExecutionPlan::NodeId const audio   {plan.AddInstruction([&] { audio.Update();   })};
+ * ExecutionPlan::NodeId const render  {plan.AddInstruction([&] { render.Update();  })};
+ *
+ * plan.AddDependency(input  , physics);
+ * plan.AddDependency(physics, render);
+ *
+ * plan.ExecutePlanAsynchronously(scheduler);
+ * \endcode
+ *
+ * \note A plan cannot be executed concurrently by several threads
+ */
 class ExecutionPlan
 {
+    public: using NodeId = RkSize;
+
     private:
 
+        /**
+         * \brief Instruction of the plan
+         */
+        struct Node
+        {
+            Job                 instruction  {};
+            std::vector<NodeId> successors   {};     ///< Sorted by descending priority once the plan is prepared
+            RkSize              predecessors {0ULL};
+            RkSize              cost         {1ULL};
+            RkSize              priority     {0ULL}; ///< Cost of the longest chain of instructions starting at this node
+        };
+
         #pragma region Members
 
         // Plan status, only used when constructing the plan
-        RkSize m_current_pack_size {0ULL};
+        NodeId m_previous_pack_begin {0ULL};
+        NodeId m_current_pack_begin  {0ULL};
 
         // Execution instructions (aka. the actual update plan)
-        std::vector<RkSize> m_packs        {};
-        std::vector<Job>    m_instructions {};
+        std::vector<Node>   m_nodes {};
+        std::vector<NodeId> m_order {}; ///< Topological order
+        std::vector<NodeId> m_roots {}; ///< Sorted by descending priority
+        RkBool              m_prepared {false};
+
+        // Remaining predecessors of every node, followed by the number of remaining nodes of the current execution
+        std::unique_ptr<std::atomic<RkSize>[]> m_counters {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Sorts the plan and computes the priority of every node if the plan has been modified
+         * \return False if the plan contains a cycle, true otherwise
+         */
+        RkBool Prepare() noexcept;
+
+        /**
+         * \brief Executes a node, then keeps executing the highest priority successor it released, if any.
+         *        Any other released successor is scheduled.
+         * \param in_scheduler Scheduler
+         * \param in_node Node to execute
+         */
+        RkVoid ExecuteNode(Scheduler& in_scheduler, NodeId in_node) noexcept;
 
         #pragma endregion
 
@@ -31,7 +97,7 @@ class ExecutionPlan
         #pragma region Constructors
 
         ExecutionPlan()                             = default;
-        ExecutionPlan(ExecutionPlan const& in_copy) = default;
+        ExecutionPlan(ExecutionPlan const& in_copy) = delete;
         ExecutionPlan(ExecutionPlan&&      in_move) = default;
         ~ExecutionPlan()                            = default;
 
@@ -45,10 +111,20 @@ class ExecutionPlan
         RkVoid ResetPlan() noexcept;
 
         /**
-         * \brief Adds an instruction to the plan (in the current instruction pack)
+         * \brief Adds an instruction to the plan (in the current instruction pack).
+         *        The instruction depends on every instruction of the previous pack.
          * \param in_instruction Job
+         * \param in_cost Estimated cost of the instruction, used to find the critical path of the plan
+         * \return Identifier of the instruction
+         */
+        NodeId AddInstruction(Job&& in_instruction, RkSize in_cost = 1ULL) noexcept;
+
+        /**
+         * \brief Adds a dependency between two instructions
+         * \param in_before Instruction that has to be executed first
+         * \param in_after Instruction depending on the first one
          */
-        RkVoid AddInstruction(Job&& in_instruction) noexcept;
+        RkVoid AddDependency(NodeId in_before, NodeId in_after) noexcept;
 
         /**
          * \brief Ends the current instruction pack, effectively creating a
@@ -57,21 +133,24 @@ class ExecutionPlan
         RkVoid EndInstructionPack() noexcept;
 
         /**
-         * \brief Starts an asynchronous execution of the plan
+         * \brief Executes the plan on the workers of the scheduler and returns once every instruction is done.
+         *        The calling thread takes part in the execution of the plan while waiting.
          * \param in_scheduler Scheduler
+         * \return False if the plan contains a cycle and could not be executed, true otherwise
          */
-        RkVoid ExecutePlanAsynchronously(Scheduler& in_scheduler) const noexcept;
+        RkBool ExecutePlanAsynchronously(Scheduler& in_scheduler) noexcept;
 
         /**
-         * \brief Starts a synchronous execution of the plan
+         * \brief Starts a synchronous execution of the plan, in topological order
+         * \return False if the plan contains a cycle and could not be executed, true otherwise
          */
-        RkVoid ExecutePlanSynchronously() const noexcept;
+        RkBool ExecutePlanSynchronously() noexcept;
 
         #pragma endregion
 
         #pragma region Operators
 
-        ExecutionPlan& operator=(ExecutionPlan const& in_copy) = default;
+        ExecutionPlan& operator=(ExecutionPlan const& in_copy) = delete;
         ExecutionPlan& operator=(ExecutionPlan&&      in_move) = default;
 
         #pragma endregion
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <string_view>
+
+#include "Build/Config.hpp"
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Threading/EAccessMode.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Records the contention of the Synchronized instances and ranks the hottest ones.
+ *
+ * Every Synchronized instance reports to the statistics of its name, instances sharing a name are aggregated.
+ * Instances are named after their value type unless renamed (see Synchronized::SetProfilingName).
+ * For each name, read and write accesses are recorded separately:
+ * acquire count, contended acquires (the lock was not immediately available), total and max wait time, total and max hold time.
+ *
+ * \note Recording is only compiled in when RUKEN_LOCK_PROFILING_ENABLED is defined (see Build/Config.hpp),
+ *       no code nor member at all is generated for the Synchronized instances otherwise.
+ */
+class LockProfiler
+{
+    public:
+
+        /**
+         * \brief Report of a single access mode of a lock
+         */
+        struct AccessReport
+        {
+            RkUint64                 acquires           {0ULL};
+            RkUint64                 contended_acquires {0ULL};
+            std::chrono::nanoseconds total_wait_time    {0};
+            std::chrono::nanoseconds max_wait_time      {0};
+            std::chrono::nanoseconds total_hold_time    {0};
+            std::chrono::nanoseconds max_hold_time      {0};
+        };
+
+        /**
+         * \brief Report of a lock, see GetReport
+         */
+        struct LockReport
+        {
+            std::string  name  {};
+            AccessReport read  {};
+            AccessReport write {};
+        };
+
+        #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+        /**
+         * \brief Live counters of a single access mode of a lock
+         */
+        struct AccessStatistics
+        {
+            std::atomic<RkUint64> acquires           {0ULL};
+            std::atomic<RkUint64> contended_acquires {0ULL};
+            std::atomic<RkInt64>  total_wait_time    {0LL}; ///< In nanoseconds
+            std::atomic<RkInt64>  max_wait_time      {0LL}; ///< In nanoseconds
+            std::atomic<RkInt64>  total_hold_time    {0LL}; ///< In nanoseconds
+            std::atomic<RkInt64>  max_hold_time      {0LL}; ///< In nanoseconds
+        };
+
+        /**
+         * \brief Live counters of a lock, shared by every Synchronized instance of the same name
+         */
+        struct LockStatistics
+        {
+            AccessStatistics read  {};
+            AccessStatistics write {};
+
+            /**
+             * \brief Returns the counters of the passed access mode
+             * \param in_mode Access mode, either read or write
+             * \return Access statistics
+             */
+            [[nodiscard]]
+            AccessStatistics& Get(EAccessMode const in_mode) noexcept
+            { return in_mode == EAccessMode::Read ? read : write; }
+        };
+
+        #endif
+
+    private:
+
+        #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+        #pragma region Members
+
+        std::mutex                                                          m_mutex      {};
+        std::map<std::string, std::unique_ptr<LockStatistics>, std::less<>> m_statistics {};
+
+        #pragma endregion
+
+        #endif
+
+    public:
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the profiler instance
+         * \return Profiler instance
+         */
+        static LockProfiler& GetInstance() noexcept;
+
+        #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+        /**
+         * \brief Returns the statistics associated with the passed name, creating them if needed
+         * \param in_name Name of the lock
+         * \return Statistics, valid for the whole lifetime of the program
+         */
+        LockStatistics& GetStatistics(std::string_view in_name) noexcept;
+
+        /**
+         * \brief Acquires a lock, recording the acquisition and its wait time
+         * \tparam TLock Lock type (std::shared_lock or std::unique_lock), must not own its mutex yet
+         * \param inout_lock Lock to acquire
+         * \param inout_statistics Statistics of the access mode
+         * \return Time point at which the lock has been acquired
+         */
+        template <typename TLock>
+        static std::chrono::steady_clock::time_point Acquire(TLock& inout_lock, AccessStatistics& inout_statistics) noexcept;
+
+        /**
+         * \brief Records the release of a lock
+         * \param inout_statistics Statistics of the access mode
+         * \param in_acquired Time point returned by Acquire
+         */
+        static RkVoid RecordRelease(AccessStatistics& inout_statistics, std::chrono::steady_clock::time_point in_acquired) noexcept;
+
+        #endif
+
+        /**
+         * \brief Returns a report of every recorded lock, ranked by total wait time, the hottest first.
+         *        Returns an empty report if lock profiling has been compiled out.
+         * \return Lock reports
+         */
+        [[nodiscard]]
+        std::vector<LockReport> GetReport() noexcept;
+
+        /**
+         * \brief Writes the report of the hottest locks, one line per lock and access mode
+         * \param inout_stream Output stream
+         * \param in_max_locks Maximum number of locks to write
+         */
+        RkVoid DumpReport(std::ostream& inout_stream, RkSize in_max_locks = 20ULL) noexcept;
+
+        #pragma endregion
+};
+
+#if defined(RUKEN_LOCK_PROFILING_ENABLED)
+    #include "Threading/LockProfiler.inl"
+#endif
+
+END_RUKEN_NAMESPACE
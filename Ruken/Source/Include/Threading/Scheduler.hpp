@@ -2,20 +2,33 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <thread>
 #include <vector>
+#include <exception>
 #include <functional>
 
 #include "Core/Service.hpp"
 #include "Build/Namespace.hpp"
-#include "Threading/OldWorker.hpp"
 #include "Debug/Logging/Logger.hpp"
 #include "Types/FundamentalTypes.hpp"
-#include "Threading/ThreadSafeLockQueue.hpp"
+#include "Core/ExecutiveSystem/CPU/CentralProcessingUnit.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CPUQueueHandle.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUTask.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUDetachedTask.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
+/**
+ * \brief Queue receiving the jobs scheduled through the Scheduler service
+ */
+struct SchedulerQueue: CPUQueueHandle<SchedulerQueue, 4096ULL> {};
+
 /**
  * \brief This class is responsible for the repartition of different tasks between workers
+ *
+ * The scheduler owns the central processing unit of the engine, every job is submitted
+ * without any lock onto the SchedulerQueue and executed by the workers of that unit.
  */
 class Scheduler final : public Service<Scheduler>
 {
@@ -25,9 +38,11 @@ class Scheduler final : public Service<Scheduler>
 
         #pragma region Members
 
-        std::vector<OldWorker>      m_workers;
-        std::atomic_bool         m_running;
-        ThreadSafeLockQueue<Job> m_job_queue;
+        std::vector<CentralProcessingQueue*> m_queues;
+        std::atomic_bool                     m_running;
+        std::atomic<RkSize>                  m_pending_jobs;
+        CentralProcessingUnit                m_processing_unit;
+        std::jthread                         m_metrics_logging;
 
         Logger* m_logger;
 
@@ -36,9 +51,20 @@ class Scheduler final : public Service<Scheduler>
         #pragma region Methods
 
         /**
-         * \brief Job given to every worker used my the scheduler
+         * \brief Executes a single job, unless the scheduler has been shut down in the meantime
+         * \param in_job Job to execute
          */
-        RkVoid WorkersJob() noexcept;
+        CPUDetachedTask<SchedulerQueue> ExecuteJob(Job in_job) noexcept;
+
+        /**
+         * \brief Awaits a task on behalf of a thread waiting for it, see WaitForTask
+         * \param in_task Task to await
+         * \param inout_remaining Counter decremented once the task is done
+         * \param out_exception Receives the exception thrown by the task, if any
+         */
+        static CPUDetachedTask<SchedulerQueue> AwaitTask(CPUTask<SchedulerQueue> in_task,
+                                                         std::atomic<RkSize>&    inout_remaining,
+                                                         std::exception_ptr&     out_exception) noexcept;
 
         #pragma endregion
 
@@ -76,17 +102,65 @@ class Scheduler final : public Service<Scheduler>
         RkVoid ScheduleTask(Job&& in_task) noexcept;
 
         /**
-         * \brief Waits until all the queued tasks are completed
+         * \brief Waits until all the queued tasks are completed.
+         *        The calling thread takes part in the execution of the jobs while waiting.
          */
         RkVoid WaitForQueuedTasks() noexcept;
 
         /**
-         * \brief Waits for all current active tasks to be done and drops any queued jobs. This also detaches any workers.
+         * \brief Waits until the passed counter reaches 0.
+         *        The calling thread takes part in the execution of the jobs while waiting, and is parked once there is none left.
+         * \param in_counter Counter to wait for, must be decremented through ReleaseCounter
+         */
+        RkVoid WaitUntilZero(std::atomic<RkSize> const& in_counter) const noexcept;
+
+        /**
+         * \brief Decrements a counter waited on through WaitUntilZero, the waiting threads are woken up once it reaches 0
+         * \param inout_counter Counter to decrement
+         * \return True if the counter reached 0, in which case the waiting thread may already have destroyed it
+         */
+        static RkBool ReleaseCounter(std::atomic<RkSize>& inout_counter) noexcept;
+
+        /**
+         * \brief Waits for the completion of a task of the scheduler queue.
+         *        The calling thread takes part in the execution of the jobs while waiting.
+         * \param in_task Task to wait for
+         * \note Any exception thrown by the task is rethrown to the caller
+         */
+        RkVoid WaitForTask(CPUTask<SchedulerQueue> in_task) const;
+
+        /**
+         * \brief Logs a snapshot of the runtime metrics of the processing unit (see CentralProcessingUnit::GetMetricsSnapshot)
+         * \note Nothing is logged if logging has been disabled in build
+         */
+        RkVoid LogMetrics() const noexcept;
+
+        /**
+         * \brief Periodically logs the runtime metrics of the processing unit from a dedicated thread, until shut down.
+         *        Calling this again replaces the previous interval.
+         * \param in_interval Time in between two logs
+         */
+        RkVoid EnableMetricsLogging(std::chrono::milliseconds in_interval) noexcept;
+
+        /**
+         * \brief Waits for all current active tasks to be done and drops any queued jobs.
          * \note This method can only be called once
          */
         RkVoid Shutdown() noexcept;
 
-        std::vector<OldWorker> const& GetWorkers() const noexcept;
+        /**
+         * \brief Returns the workers of the scheduler
+         * \return Workers
+         */
+        [[nodiscard]]
+        std::vector<std::unique_ptr<Worker>> const& GetWorkers() const noexcept;
+
+        /**
+         * \brief Returns the processing unit owned by the scheduler
+         * \return Central processing unit
+         */
+        [[nodiscard]]
+        CentralProcessingUnit& GetProcessingUnit() noexcept;
 
         #pragma endregion 
 
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+#include <atomic_queue/defs.h>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "Threading/EAccessMode.hpp"
+#include "Threading/SeqLockedAccess.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Sequence locked value, for small trivially copyable states read much more often than written (camera, settings...)
+ * \tparam TType Type of the value, must be trivially copyable
+ *
+ * Readers never write to any shared memory: they copy the value and retry if a writer modified it in the meantime.
+ * Writers are serialized between them and are never blocked by readers.
+ *
+ * \code
+ * SeqLocked<CameraState> camera;
+ *
+ * {
+ *     decltype(camera)::ReadAccess access {camera}; // Consistent copy of the value
+ *     Render(access->view, access->projection);
+ * }
+ *
+ * {
+ *     decltype(camera)::WriteAccess access {camera};
+ *     access->view = ComputeView(); // Published when the access is destroyed
+ * }
+ * \endcode
+ *
+ * \note The value is stored as atomic words, this avoids any data race between a reader and a writer.
+ *       Readers retry as long as a writer is working, write accesses should be kept short.
+ */
+template<typename TType>
+class SeqLocked
+{
+    static_assert(std::is_trivially_copyable_v<TType>, "SeqLocked values are copied byte per byte");
+    static_assert(std::is_default_constructible_v<TType>, "SeqLocked values are read into a default constructed value");
+
+    // Allows the exclusive access to the members
+    template<class, EAccessMode> friend class SeqLockedAccess;
+
+    public:
+
+        using ReadAccess     = SeqLockedAccess<TType, EAccessMode::Read >;
+        using WriteAccess    = SeqLockedAccess<TType, EAccessMode::Write>;
+        using UnderlyingType = TType;
+
+    private:
+
+        static constexpr RkSize word_count {(sizeof(TType) + sizeof(RkUint64) - 1ULL) / sizeof(RkUint64)};
+
+        #pragma region Variables
+
+        std::atomic<RkUint64>                         m_sequence; ///< Odd while a writer is working
+        std::array<std::atomic<RkUint64>, word_count> m_words;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Copies the value without checking the sequence
+         * \param out_value Destination
+         */
+        RkVoid LoadWords(TType& out_value) const noexcept;
+
+        /**
+         * \brief Overwrites the value without updating the sequence
+         * \param in_value New value
+         */
+        RkVoid StoreWords(TType const& in_value) noexcept;
+
+        /**
+         * \brief Waits for the other writers and starts a write
+         * \return Sequence before the write, even
+         */
+        RkUint64 BeginWrite() noexcept;
+
+        /**
+         * \brief Ends a write started with BeginWrite, publishing the new value to the readers
+         * \param in_sequence Sequence returned by BeginWrite
+         */
+        RkVoid EndWrite(RkUint64 in_sequence) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Constructs the content of the synchronized object using the following constructor: Type(Args...)
+         * \tparam TArgs Arguments type
+         * \param in_args arguments
+         */
+        template <typename ...TArgs, typename = std::enable_if_t<std::is_constructible_v<TType, TArgs...>>>
+        SeqLocked(TArgs... in_args) noexcept;
+
+        SeqLocked()                         noexcept;
+        SeqLocked(SeqLocked const& in_copy) = delete;
+        SeqLocked(SeqLocked&&      in_move) = delete;
+        ~SeqLocked()                        = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns a consistent copy of the value
+         * \return Copy of the value
+         */
+        [[nodiscard]]
+        TType Load() const noexcept;
+
+        /**
+         * \brief Replaces the whole value
+         * \param in_value New value
+         */
+        RkVoid Store(TType const& in_value) noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        SeqLocked& operator=(SeqLocked const& in_copy) = delete;
+        SeqLocked& operator=(SeqLocked&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Threading/SeqLocked.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Threading/EAccessMode.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+template <typename TType>
+class SeqLocked;
+
+template<class TData, EAccessMode TMode>
+class SeqLockedAccess;
+
+/**
+ * \brief Allows safe accesses to a SeqLocked object using the RAII principle
+ * \brief Read access specialization
+ *
+ * The access holds a consistent copy of the value, taken upon construction. It never blocks writers.
+ *
+ * \tparam TData SeqLocked object's type
+ */
+template<class TData>
+class SeqLockedAccess<TData, EAccessMode::Read>
+{
+    private:
+
+        #pragma region Members
+
+        TData m_value;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        SeqLockedAccess(SeqLocked<TData> const& in_synchronized) noexcept;
+
+        SeqLockedAccess(SeqLockedAccess const& in_copy) = delete;
+        SeqLockedAccess(SeqLockedAccess&&      in_move) = delete;
+        ~SeqLockedAccess()                              = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Synchronized getter
+         * \return Copy of the synchronized object's content
+         */
+        [[nodiscard]]
+        TData const& Get() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        SeqLockedAccess& operator=(SeqLockedAccess const& in_copy) = delete;
+        SeqLockedAccess& operator=(SeqLockedAccess&&      in_move) = delete;
+
+        [[nodiscard]] TData const& operator* () const noexcept;
+        [[nodiscard]] TData const* operator->() const noexcept;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Allows safe accesses to a SeqLocked object using the RAII principle
+ * \brief Write access specialization
+ *
+ * Other writers are excluded and readers keep retrying for the whole lifetime of the access,
+ * the modified value is published when the access is destroyed.
+ *
+ * \tparam TData SeqLocked object's type
+ */
+template<class TData>
+class SeqLockedAccess<TData, EAccessMode::Write>
+{
+    private:
+
+        #pragma region Members
+
+        SeqLocked<TData>& m_synchronized;
+        RkUint64          m_sequence;
+        TData             m_value;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        SeqLockedAccess(SeqLocked<TData>& in_synchronized) noexcept;
+
+        SeqLockedAccess(SeqLockedAccess const& in_copy) = delete;
+        SeqLockedAccess(SeqLockedAccess&&      in_move) = delete;
+
+        /**
+         * \brief Publishes the modified value
+         */
+        ~SeqLockedAccess() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Synchronized getters
+         * \return Synchronized object's content
+         */
+        [[nodiscard]] TData&       Get()       noexcept;
+        [[nodiscard]] TData const& Get() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        SeqLockedAccess& operator=(SeqLockedAccess const& in_copy) = delete;
+        SeqLockedAccess& operator=(SeqLockedAccess&&      in_move) = delete;
+
+        [[nodiscard]] TData&       operator* ()       noexcept;
+        [[nodiscard]] TData const& operator* () const noexcept;
+
+        [[nodiscard]] TData*       operator->()       noexcept;
+        [[nodiscard]] TData const* operator->() const noexcept;
+
+        #pragma endregion
+};
+
+#include "Threading/SeqLockedAccess.inl"
+
+END_RUKEN_NAMESPACE
@@ -1,11 +1,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <typeinfo>
+#include <string_view>
 #include <shared_mutex>
 
+#include "Build/Config.hpp"
 #include "Build/Namespace.hpp"
 
 #include "Threading/EAccessMode.hpp"
+#include "Threading/LockProfiler.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
@@ -30,6 +35,9 @@ class SynchronizedAccess;
  * Simple and easy to use
  *    - Simply replace your mutex by Synchronized objects and locks by SynchronizedAccess objects.
  * 
+ * When lock profiling is enabled (see LockProfiler), every read and write access is recorded
+ * under the profiling name of the instance.
+ * 
  * TODO: Synchronized move and copy operators/constructors
  */
 template<typename TType>
@@ -53,6 +61,12 @@ class Synchronized
         mutable std::shared_mutex m_mutex;
         TType                     m_value;
 
+        #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+        std::atomic<LockProfiler::LockStatistics*> m_statistics {&LockProfiler::GetInstance().GetStatistics(typeid(TType).name())};
+
+        #endif
+
         #pragma endregion
 
     public:
@@ -85,6 +99,14 @@ class Synchronized
         [[nodiscard]]
         TType&       Unsafe()       noexcept;
 
+        /**
+         * \brief Sets the name this instance is reported under by the LockProfiler, defaults to the name of the value type.
+         *        Instances sharing a name are aggregated. Does nothing if lock profiling is disabled.
+         * \note Safe to call while the instance is accessed, accesses alive at that time keep reporting to the previous name.
+         * \param in_name Profiling name
+         */
+        RkVoid SetProfilingName(std::string_view in_name) noexcept;
+
         #pragma region Operators
 
         Synchronized& operator=(Synchronized const& in_copy) = delete;
@@ -1,10 +1,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <shared_mutex>
 
+#include "Build/Config.hpp"
 #include "Build/Namespace.hpp"
 #include "Threading/EAccessMode.hpp"
+#include "Threading/LockProfiler.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
@@ -83,6 +86,13 @@ class SynchronizedAccess<TData, EAccessMode::Read>
         Synchronized<TData>&                m_synchronized;
         std::shared_lock<std::shared_mutex> m_lock;
 
+        #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+        LockProfiler::AccessStatistics&       m_statistics;
+        std::chrono::steady_clock::time_point m_acquired;
+
+        #endif
+
         #pragma endregion 
 
     public:
@@ -93,7 +103,12 @@ class SynchronizedAccess<TData, EAccessMode::Read>
 
         SynchronizedAccess(SynchronizedAccess const& in_copy)  = delete;
         SynchronizedAccess(SynchronizedAccess&&      in_move)  = default;
+
+        #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+        ~SynchronizedAccess() noexcept;
+        #else
         ~SynchronizedAccess()                                  = default;
+        #endif
 
         #pragma endregion
 
@@ -137,6 +152,13 @@ class SynchronizedAccess<TData, EAccessMode::Write>
         Synchronized<TData>&                m_synchronized;
         std::unique_lock<std::shared_mutex> m_lock;
 
+        #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+        LockProfiler::AccessStatistics&       m_statistics;
+        std::chrono::steady_clock::time_point m_acquired;
+
+        #endif
+
         #pragma endregion 
 
     public:
@@ -147,7 +169,12 @@ class SynchronizedAccess<TData, EAccessMode::Write>
 
         SynchronizedAccess(SynchronizedAccess const& in_copy) = delete;
         SynchronizedAccess(SynchronizedAccess&&      in_move) = default;
+
+        #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+        ~SynchronizedAccess() noexcept;
+        #else
         ~SynchronizedAccess()                                 = default;
+        #endif
 
         #pragma endregion
 
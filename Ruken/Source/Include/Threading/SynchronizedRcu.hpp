@@ -0,0 +1,109 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <type_traits>
+
+#include "Build/Namespace.hpp"
+
+#include "Threading/EAccessMode.hpp"
+#include "Threading/EpochReclaimer.hpp"
+#include "Threading/SynchronizedRcuAccess.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Read-mostly variant of Synchronized, using read-copy-update semantics
+ * \tparam TType Type of the synchronized value, must be copy constructible
+ *
+ * Readers never take any lock: a read access loads a pointer to the current version of the value,
+ * which stays alive for the whole duration of the access thanks to epoch based reclamation (see EpochReclaimer).
+ * Readers do not write to any shared cache line, which makes reads scale with the number of threads.
+ *
+ * Writers are serialized by a mutex. A write access works on a private copy of the current version
+ * which is published at once when the access is destroyed. Older versions are destroyed once no reader can access them anymore.
+ *
+ * \code
+ * SynchronizedRcu<std::unordered_map<Key, Value>> table;
+ *
+ * {
+ *     decltype(table)::ReadAccess access {table};
+ *     auto it = access->find(key); // Wait-free, never blocked by writers
+ * }
+ *
+ * {
+ *     decltype(table)::WriteAccess access {table};
+ *     access->emplace(key, value); // Visible to new readers once the access is destroyed
+ * }
+ * \endcode
+ *
+ * \note Every write copies the whole value, this is only worth it for values that are read much more often than written.
+ *       Readers might keep seeing the previous version for as long as their access is alive.
+ */
+template<typename TType>
+class SynchronizedRcu
+{
+    static_assert(std::is_copy_constructible_v<TType>, "SynchronizedRcu values are copied on write");
+
+    // Allows the exclusive access to the members
+    template<class, EAccessMode> friend class SynchronizedRcuAccess;
+
+    public:
+
+        using ReadAccess     = SynchronizedRcuAccess<TType, EAccessMode::Read >;
+        using WriteAccess    = SynchronizedRcuAccess<TType, EAccessMode::Write>;
+        using UnderlyingType = TType;
+
+    private:
+
+        #pragma region Variables
+
+        std::mutex          m_write_mutex;
+        std::atomic<TType*> m_current;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Constructs the content of the synchronized object using the following constructor: Type(Args...)
+         * \tparam TArgs Arguments type
+         * \param in_args arguments
+         */
+        template <typename ...TArgs, typename = std::enable_if_t<std::is_constructible_v<TType, TArgs...>>>
+        SynchronizedRcu(TArgs... in_args);
+
+        SynchronizedRcu();
+        SynchronizedRcu(SynchronizedRcu const& in_copy) = delete;
+        SynchronizedRcu(SynchronizedRcu&&      in_move) = delete;
+
+        /**
+         * \brief Destroys the current version of the value
+         * \warning No access can be alive at this point
+         */
+        ~SynchronizedRcu() noexcept;
+
+        #pragma endregion
+
+        /**
+         * \brief Unsafe single time access to content of the synchronized object
+         *
+         * \warning This method should be used wisely. The returned version can be destroyed at any time by a concurrent write !
+         * \return Synchronized object's content
+         */
+        [[nodiscard]]
+        TType const& Unsafe() const noexcept;
+
+        #pragma region Operators
+
+        SynchronizedRcu& operator=(SynchronizedRcu const& in_copy) = delete;
+        SynchronizedRcu& operator=(SynchronizedRcu&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Threading/SynchronizedRcu.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <mutex>
+#include <memory>
+
+#include "Build/Namespace.hpp"
+#include "Threading/EAccessMode.hpp"
+#include "Threading/EpochReclaimer.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+template <typename TType>
+class SynchronizedRcu;
+
+template<class TData, EAccessMode TMode>
+class SynchronizedRcuAccess;
+
+/**
+ * \brief Allows safe accesses to a SynchronizedRcu object using the RAII principle
+ * \brief Read access specialization, wait-free
+ *
+ * The accessed version of the value stays the same for the whole lifetime of the access, even if writers publish newer ones.
+ *
+ * \tparam TData SynchronizedRcu object's type
+ */
+template<class TData>
+class SynchronizedRcuAccess<TData, EAccessMode::Read>
+{
+    private:
+
+        #pragma region Members
+
+        EpochReclaimer::ReadGuard m_guard;
+        TData const*              m_value;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        SynchronizedRcuAccess(SynchronizedRcu<TData>& in_synchronized) noexcept;
+
+        SynchronizedRcuAccess(SynchronizedRcuAccess const& in_copy) = delete;
+        SynchronizedRcuAccess(SynchronizedRcuAccess&&      in_move) = delete;
+        ~SynchronizedRcuAccess()                                    = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Synchronized getter
+         * \return Synchronized's object content
+         */
+        [[nodiscard]]
+        TData const& Get() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        SynchronizedRcuAccess& operator=(SynchronizedRcuAccess const& in_copy) = delete;
+        SynchronizedRcuAccess& operator=(SynchronizedRcuAccess&&      in_move) = delete;
+
+        [[nodiscard]] TData const& operator* () const noexcept;
+        [[nodiscard]] TData const* operator->() const noexcept;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Allows safe accesses to a SynchronizedRcu object using the RAII principle
+ * \brief Write access specialization
+ *
+ * The access works on a copy of the current version, published when the access is destroyed.
+ * Readers do not see any of the changes until then.
+ *
+ * \tparam TData SynchronizedRcu object's type
+ */
+template<class TData>
+class SynchronizedRcuAccess<TData, EAccessMode::Write>
+{
+    private:
+
+        #pragma region Members
+
+        SynchronizedRcu<TData>&      m_synchronized;
+        std::unique_lock<std::mutex> m_lock;
+        std::unique_ptr<TData>       m_copy;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        SynchronizedRcuAccess(SynchronizedRcu<TData>& in_synchronized);
+
+        SynchronizedRcuAccess(SynchronizedRcuAccess const& in_copy) = delete;
+        SynchronizedRcuAccess(SynchronizedRcuAccess&&      in_move) = delete;
+
+        /**
+         * \brief Publishes the modified copy, the previous version is retired
+         */
+        ~SynchronizedRcuAccess() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Synchronized getters
+         * \return Copy of the synchronized object's content, to be published
+         */
+        [[nodiscard]] TData&       Get()       noexcept;
+        [[nodiscard]] TData const& Get() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        SynchronizedRcuAccess& operator=(SynchronizedRcuAccess const& in_copy) = delete;
+        SynchronizedRcuAccess& operator=(SynchronizedRcuAccess&&      in_move) = delete;
+
+        [[nodiscard]] TData&       operator* ()       noexcept;
+        [[nodiscard]] TData const& operator* () const noexcept;
+
+        [[nodiscard]] TData*       operator->()       noexcept;
+        [[nodiscard]] TData const* operator->() const noexcept;
+
+        #pragma endregion
+};
+
+#include "Threading/SynchronizedRcuAccess.inl"
+
+END_RUKEN_NAMESPACE
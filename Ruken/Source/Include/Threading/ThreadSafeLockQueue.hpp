@@ -4,6 +4,7 @@
 #include "Build/Namespace.hpp"
 
 #include <mutex>
+#include <condition_variable>
 #include <queue>
 #include <atomic>
 
@@ -77,6 +77,13 @@ class ControlClock
          */
         RkFloat GetUnscaledControlTime() const noexcept;
 
+        /**
+         * \brief Queries the time at which the next ControlPoint() call is expected, based on the frequency of the clock.
+         *        This can be used as the deadline of the jobs that must be done by the end of the current cycle.
+         * \return Time of the next control point
+         */
+        std::chrono::steady_clock::time_point GetNextControlPoint() const noexcept;
+
         #pragma endregion
 
         #pragma region Operators
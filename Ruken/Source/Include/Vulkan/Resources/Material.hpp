@@ -34,9 +34,9 @@ class Material final : public IResource
 
         #pragma region Methods
 
-        RkVoid Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
+        CPUTask<SchedulerQueue> Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
 
-        RkVoid Reload(ResourceManager& in_manager) override;
+        CPUTask<SchedulerQueue> Reload(ResourceManager& in_manager) override;
 
         RkVoid Unload(ResourceManager& in_manager) noexcept override;
 
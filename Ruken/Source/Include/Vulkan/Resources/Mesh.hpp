@@ -35,10 +35,11 @@ class Mesh final : public IResource
         static std::optional<VulkanBuffer> CreateVertexBuffer   (VulkanDeviceAllocator const& in_allocator, RkUint64 in_size) noexcept;
         static std::optional<VulkanBuffer> CreateIndexBuffer    (VulkanDeviceAllocator const& in_allocator, RkUint64 in_size) noexcept;
 
-        RkVoid UploadData(VulkanDevice           const& in_device,
-                           VulkanDeviceAllocator  const& in_allocator,
-                           std::vector<Vertex>    const& in_vertices,
-                           std::vector<RkUint32> const& in_indices) const;
+        // The transfer is waited for on the blocking thread pool, the worker is free in the meantime
+        CPUTask<SchedulerQueue> UploadData(VulkanDevice           const& in_device,
+                                           VulkanDeviceAllocator  const& in_allocator,
+                                           std::vector<Vertex>    const& in_vertices,
+                                           std::vector<RkUint32> const& in_indices) const;
 
         #pragma endregion
 
@@ -57,9 +58,9 @@ class Mesh final : public IResource
 
         #pragma region Methods
 
-        RkVoid Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
+        CPUTask<SchedulerQueue> Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
 
-        RkVoid Reload(ResourceManager& in_manager) override;
+        CPUTask<SchedulerQueue> Reload(ResourceManager& in_manager) override;
 
         RkVoid Unload(ResourceManager& in_manager) noexcept override;
 
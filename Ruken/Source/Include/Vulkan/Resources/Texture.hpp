@@ -32,10 +32,11 @@ class Texture final : public IResource
         static std::optional<VulkanImage>   CreateImage         (VulkanDeviceAllocator const& in_allocator, RkUint32 in_width, RkUint32 in_height) noexcept;
         static std::optional<VulkanBuffer>  CreateStagingBuffer (VulkanDeviceAllocator const& in_allocator, RkUint64 in_size) noexcept;
 
-        RkVoid UploadData(VulkanDevice          const& in_device,
-                           VulkanDeviceAllocator const& in_allocator,
-                           RkVoid               const* in_data,
-                           RkUint64                    in_size) const;
+        // The transfer is waited for on the blocking thread pool, the worker is free in the meantime
+        CPUTask<SchedulerQueue> UploadData(VulkanDevice          const& in_device,
+                                           VulkanDeviceAllocator const& in_allocator,
+                                           RkVoid               const* in_data,
+                                           RkUint64                    in_size) const;
 
         #pragma endregion
 
@@ -54,9 +55,9 @@ class Texture final : public IResource
 
         #pragma region Methods
 
-        RkVoid Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
+        CPUTask<SchedulerQueue> Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
 
-        RkVoid Reload(ResourceManager& in_manager) override;
+        CPUTask<SchedulerQueue> Reload(ResourceManager& in_manager) override;
 
         RkVoid Unload(ResourceManager& in_manager) noexcept override;
 
@@ -0,0 +1,489 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+
+#include "Core/ExecutiveSystem/Benchmarks/ExecutiveBenchmarks.hpp"
+
+#include "Core/ExecutiveSystem/CPU/CentralProcessingUnit.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CPUQueueHandle.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUTask.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Tasks/CPUDetachedTask.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/TaskGroup.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/CountDownLatch.hpp"
+
+#include "Threading/OldWorker.hpp"
+#include "Threading/ThreadSafeLockQueue.hpp"
+
+USING_RUKEN_NAMESPACE
+
+BEGIN_RUKEN_NAMESPACE
+
+namespace internal
+{
+    using BenchmarkClock = std::chrono::steady_clock;
+
+    struct BenchmarkQueue: CPUQueueHandle<BenchmarkQueue, 65536ULL> {};
+
+    constexpr RkSize benchmark_throughput_batch {4096ULL}; ///< Empty tasks per throughput round
+    constexpr RkSize benchmark_fan_out_width    {256ULL};  ///< Work items per fan-out round
+    constexpr RkSize benchmark_fan_out_work     {512ULL};  ///< Iterations of each fan-out work item
+    constexpr RkSize benchmark_chain_depth      {256ULL};  ///< Tasks per continuation chain
+    constexpr RkSize benchmark_ecs_entities     {16384ULL};
+    constexpr RkSize benchmark_ecs_chunk        {1024ULL};
+    constexpr RkSize benchmark_ecs_phases       {3ULL};    ///< Acceleration, velocity and position integration
+    constexpr RkSize benchmark_ecs_axes         {3ULL};    ///< One system per axis and per phase
+    constexpr RkSize benchmark_ecs_chunks       {benchmark_ecs_entities / benchmark_ecs_chunk};
+    constexpr RkSize benchmark_ecs_frame_tasks  {benchmark_ecs_phases * benchmark_ecs_axes * benchmark_ecs_chunks};
+
+    /**
+     * \brief Component storage of the synthetic ECS frame, one array per axis
+     */
+    struct BenchmarkWorld
+    {
+        std::array<std::vector<RkFloat>, benchmark_ecs_axes> acceleration {};
+        std::array<std::vector<RkFloat>, benchmark_ecs_axes> velocity     {};
+        std::array<std::vector<RkFloat>, benchmark_ecs_axes> position     {};
+
+        BenchmarkWorld()
+        {
+            for (RkSize axis = 0ULL; axis < benchmark_ecs_axes; ++axis)
+            {
+                acceleration[axis].assign(benchmark_ecs_entities, 0.1F);
+                velocity    [axis].assign(benchmark_ecs_entities, 0.0F);
+                position    [axis].assign(benchmark_ecs_entities, 0.0F);
+            }
+        }
+    };
+
+    /**
+     * \brief Runs the system of the given phase and axis on a single chunk of entities
+     */
+    RkVoid BenchmarkEcsChunk(BenchmarkWorld& inout_world, RkSize const in_phase, RkSize const in_axis, RkSize const in_chunk) noexcept
+    {
+        constexpr RkFloat delta_time {1.0F / 60.0F};
+
+        RkSize const begin {in_chunk * benchmark_ecs_chunk};
+        RkSize const end   {begin + benchmark_ecs_chunk};
+
+        std::vector<RkFloat>& acceleration {inout_world.acceleration[in_axis]};
+        std::vector<RkFloat>& velocity     {inout_world.velocity    [in_axis]};
+        std::vector<RkFloat>& position     {inout_world.position    [in_axis]};
+
+        for (RkSize index = begin; index < end; ++index)
+        {
+            switch (in_phase)
+            {
+                case 0ULL: acceleration[index] = -0.01F * position[index];              break;
+                case 1ULL: velocity    [index] += acceleration[index] * delta_time;    break;
+                default:   position    [index] += velocity    [index] * delta_time;    break;
+            }
+        }
+    }
+
+    /**
+     * \brief Small amount of busy work that cannot be optimized away
+     */
+    RkVoid BenchmarkWork() noexcept
+    {
+        static thread_local RkFloat sink {0.0F};
+
+        RkFloat value {sink};
+        for (RkSize index = 0ULL; index < benchmark_fan_out_work; ++index)
+            value = std::sqrt(value + static_cast<RkFloat>(index));
+
+        sink = value;
+    }
+
+    /**
+     * \brief Computes the statistics of a scenario from its round durations
+     */
+    ExecutiveBenchmarkResult BenchmarkResult(std::string in_scenario, std::string in_backend, RkSize const in_workers,
+                                             std::vector<RkDouble> in_durations_us, RkSize const in_tasks_per_sample)
+    {
+        ExecutiveBenchmarkResult result {
+            .scenario         = std::move(in_scenario),
+            .backend          = std::move(in_backend),
+            .workers          = in_workers,
+            .samples          = in_durations_us.size(),
+            .tasks_per_sample = in_tasks_per_sample
+        };
+
+        if (in_durations_us.empty())
+            return result;
+
+        RkDouble total_us {0.0};
+        for (RkDouble const duration: in_durations_us)
+            total_us += duration;
+
+        std::ranges::sort(in_durations_us);
+
+        auto const percentile = [&](RkDouble const in_ratio) {
+            RkSize const rank {static_cast<RkSize>(std::ceil(in_ratio * static_cast<RkDouble>(in_durations_us.size())))};
+            return in_durations_us[std::clamp(rank, RkSize {1ULL}, in_durations_us.size()) - 1ULL];
+        };
+
+        result.p50_us           = percentile(0.50);
+        result.p99_us           = percentile(0.99);
+        result.tasks_per_second = total_us > 0.0 ? static_cast<RkDouble>(in_tasks_per_sample * in_durations_us.size()) * 1e6 / total_us : 0.0;
+
+        return result;
+    }
+
+    /**
+     * \brief Returns the elapsed time since the passed time point in microseconds
+     */
+    RkDouble BenchmarkElapsed(BenchmarkClock::time_point const in_start) noexcept
+    {
+        return std::chrono::duration<RkDouble, std::micro>(BenchmarkClock::now() - in_start).count();
+    }
+
+    #pragma region Executive system
+
+    /**
+     * \brief Round durations of every executive system scenario, in microseconds
+     */
+    struct ExecutiveSamples
+    {
+        std::vector<RkDouble> spawn_latency {};
+        std::vector<RkDouble> throughput    {};
+        std::vector<RkDouble> fan_out       {};
+        std::vector<RkDouble> chain         {};
+        std::vector<RkDouble> ecs_frame     {};
+    };
+
+    CPUTask<BenchmarkQueue> BenchmarkEmptyTask()
+    { co_return; }
+
+    CPUDetachedTask<BenchmarkQueue> BenchmarkCountDownTask(CountDownLatch& inout_latch)
+    {
+        inout_latch.CountDown();
+        co_return;
+    }
+
+    CPUDetachedTask<BenchmarkQueue> BenchmarkWorkTask(CountDownLatch& inout_latch)
+    {
+        BenchmarkWork();
+        inout_latch.CountDown();
+        co_return;
+    }
+
+    CPUTask<BenchmarkQueue, RkSize> BenchmarkChainTask(RkSize const in_depth)
+    {
+        if (in_depth == 0ULL)
+            co_return 0ULL;
+
+        co_return 1ULL + co_await BenchmarkChainTask(in_depth - 1ULL);
+    }
+
+    CPUTask<BenchmarkQueue> BenchmarkEcsTask(BenchmarkWorld& inout_world, RkSize const in_phase, RkSize const in_axis, RkSize const in_chunk)
+    {
+        BenchmarkEcsChunk(inout_world, in_phase, in_axis, in_chunk);
+        co_return;
+    }
+
+    /**
+     * \brief Runs every scenario, the first round of each one is used as a warmup and is not recorded
+     */
+    CPUTask<BenchmarkQueue> BenchmarkExecutiveSuite(RkSize const in_samples, ExecutiveSamples& out_samples, std::stop_source& inout_done)
+    {
+        for (RkSize round = 0ULL; round <= in_samples; ++round)
+        {
+            BenchmarkClock::time_point const start {BenchmarkClock::now()};
+            co_await BenchmarkEmptyTask();
+
+            if (round != 0ULL)
+                out_samples.spawn_latency.emplace_back(BenchmarkElapsed(start));
+        }
+
+        for (RkSize round = 0ULL; round <= in_samples; ++round)
+        {
+            CountDownLatch latch {benchmark_throughput_batch};
+
+            BenchmarkClock::time_point const start {BenchmarkClock::now()};
+            for (RkSize index = 0ULL; index < benchmark_throughput_batch; ++index)
+                BenchmarkCountDownTask(latch);
+            co_await latch;
+
+            if (round != 0ULL)
+                out_samples.throughput.emplace_back(BenchmarkElapsed(start));
+        }
+
+        for (RkSize round = 0ULL; round <= in_samples; ++round)
+        {
+            CountDownLatch latch {benchmark_fan_out_width};
+
+            BenchmarkClock::time_point const start {BenchmarkClock::now()};
+            for (RkSize index = 0ULL; index < benchmark_fan_out_width; ++index)
+                BenchmarkWorkTask(latch);
+            co_await latch;
+
+            if (round != 0ULL)
+                out_samples.fan_out.emplace_back(BenchmarkElapsed(start));
+        }
+
+        for (RkSize round = 0ULL; round <= in_samples; ++round)
+        {
+            BenchmarkClock::time_point const start {BenchmarkClock::now()};
+            co_await BenchmarkChainTask(benchmark_chain_depth);
+
+            if (round != 0ULL)
+                out_samples.chain.emplace_back(BenchmarkElapsed(start));
+        }
+
+        BenchmarkWorld world {};
+        for (RkSize round = 0ULL; round <= in_samples; ++round)
+        {
+            BenchmarkClock::time_point const start {BenchmarkClock::now()};
+            for (RkSize phase = 0ULL; phase < benchmark_ecs_phases; ++phase)
+            {
+                TaskGroup group;
+                for (RkSize axis = 0ULL; axis < benchmark_ecs_axes; ++axis)
+                    for (RkSize chunk = 0ULL; chunk < benchmark_ecs_chunks; ++chunk)
+                        group.Spawn(BenchmarkEcsTask(world, phase, axis, chunk));
+
+                co_await group.Join();
+            }
+
+            if (round != 0ULL)
+                out_samples.ecs_frame.emplace_back(BenchmarkElapsed(start));
+        }
+
+        inout_done.request_stop();
+    }
+
+    #pragma endregion
+
+    #pragma region Legacy pool
+
+    /**
+     * \brief Mirror of the former Scheduler pool: OldWorker threads consuming a single ThreadSafeLockQueue.
+     *        Kept as a baseline since the Scheduler service now runs on the executive system.
+     */
+    class LegacyPool
+    {
+        public: using Job = std::function<RkVoid()>;
+
+        private:
+
+            ThreadSafeLockQueue<Job> m_queue   {};
+            std::atomic<RkSize>      m_running {0ULL};
+            std::vector<OldWorker>   m_workers;
+
+            RkVoid Routine() noexcept
+            {
+                Job job;
+                while (m_queue.Dequeue(job))
+                    job();
+
+                m_running.fetch_sub(1ULL, std::memory_order_release);
+            }
+
+        public:
+
+            explicit LegacyPool(RkSize const in_workers):
+                m_running {in_workers},
+                m_workers {in_workers}
+            {
+                for (OldWorker& worker: m_workers)
+                    worker.Execute(&LegacyPool::Routine, this);
+            }
+
+            LegacyPool(LegacyPool const&) = delete;
+            LegacyPool(LegacyPool&&)      = delete;
+
+            ~LegacyPool()
+            {
+                // Releasing until every worker left, the workers are then joined by their destructors
+                while (m_running.load(std::memory_order_acquire) != 0ULL)
+                {
+                    m_queue.Release();
+                    std::this_thread::yield();
+                }
+            }
+
+            LegacyPool& operator=(LegacyPool const&) = delete;
+            LegacyPool& operator=(LegacyPool&&)      = delete;
+
+            RkVoid Schedule(Job&& in_job) noexcept
+            {
+                m_queue.Enqueue(std::move(in_job));
+            }
+    };
+
+    /**
+     * \brief Busy waits until the passed counter reaches 0, like the legacy Scheduler::WaitForQueuedTasks
+     */
+    RkVoid BenchmarkWaitFor(std::atomic<RkSize> const& in_counter) noexcept
+    {
+        while (in_counter.load(std::memory_order_acquire) != 0ULL)
+            std::this_thread::yield();
+    }
+
+    /**
+     * \brief Schedules the next link of a legacy continuation chain
+     */
+    RkVoid BenchmarkLegacyChain(LegacyPool& inout_pool, std::atomic<RkSize>& inout_remaining) noexcept
+    {
+        if (inout_remaining.fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+            return;
+
+        inout_pool.Schedule([&inout_pool, &inout_remaining] {
+            BenchmarkLegacyChain(inout_pool, inout_remaining);
+        });
+    }
+
+    #pragma endregion
+}
+
+END_RUKEN_NAMESPACE
+
+ExecutiveBenchmarks::ExecutiveBenchmarks(RkSize const in_max_workers, RkSize const in_samples) noexcept:
+    m_max_workers {in_max_workers == 0ULL ? std::max(std::thread::hardware_concurrency(), 1U) : in_max_workers},
+    m_samples     {std::max(in_samples, RkSize {1ULL})}
+{}
+
+RkVoid ExecutiveBenchmarks::RunExecutive(RkSize const in_workers)
+{
+    internal::ExecutiveSamples samples {};
+
+    {
+        CentralProcessingUnit unit {in_workers - 1ULL, {&internal::BenchmarkQueue::GetInstance()}};
+
+        std::stop_source done {};
+        CPUTask<internal::BenchmarkQueue> const suite {internal::BenchmarkExecutiveSuite(m_samples, samples, done)};
+
+        unit.CallerAsWorker(done.get_token());
+    }
+
+    m_results.emplace_back(internal::BenchmarkResult("SpawnLatency", "executive", in_workers, std::move(samples.spawn_latency), 1ULL));
+    m_results.emplace_back(internal::BenchmarkResult("Throughput"  , "executive", in_workers, std::move(samples.throughput)   , internal::benchmark_throughput_batch));
+    m_results.emplace_back(internal::BenchmarkResult("FanOutFanIn" , "executive", in_workers, std::move(samples.fan_out)      , internal::benchmark_fan_out_width));
+    m_results.emplace_back(internal::BenchmarkResult("DeepChain"   , "executive", in_workers, std::move(samples.chain)        , internal::benchmark_chain_depth + 1ULL));
+    m_results.emplace_back(internal::BenchmarkResult("EcsFrame"    , "executive", in_workers, std::move(samples.ecs_frame)    , internal::benchmark_ecs_frame_tasks));
+}
+
+RkVoid ExecutiveBenchmarks::RunLegacy(RkSize const in_workers)
+{
+    using internal::BenchmarkClock;
+
+    internal::LegacyPool  pool    {in_workers};
+    std::atomic<RkSize>   pending {0ULL};
+    std::vector<RkDouble> durations {};
+
+    auto const measure = [&](RkChar const* in_scenario, RkSize const in_tasks, auto&& in_round) {
+        durations.clear();
+        for (RkSize round = 0ULL; round <= m_samples; ++round)
+        {
+            BenchmarkClock::time_point const start {BenchmarkClock::now()};
+            in_round();
+
+            if (round != 0ULL)
+                durations.emplace_back(internal::BenchmarkElapsed(start));
+        }
+
+        m_results.emplace_back(internal::BenchmarkResult(in_scenario, "legacy", in_workers, durations, in_tasks));
+    };
+
+    measure("SpawnLatency", 1ULL, [&] {
+        pending.store(1ULL, std::memory_order_release);
+        pool.Schedule([&pending] { pending.fetch_sub(1ULL, std::memory_order_acq_rel); });
+        internal::BenchmarkWaitFor(pending);
+    });
+
+    measure("Throughput", internal::benchmark_throughput_batch, [&] {
+        pending.store(internal::benchmark_throughput_batch, std::memory_order_release);
+        for (RkSize index = 0ULL; index < internal::benchmark_throughput_batch; ++index)
+            pool.Schedule([&pending] { pending.fetch_sub(1ULL, std::memory_order_acq_rel); });
+        internal::BenchmarkWaitFor(pending);
+    });
+
+    measure("FanOutFanIn", internal::benchmark_fan_out_width, [&] {
+        pending.store(internal::benchmark_fan_out_width, std::memory_order_release);
+        for (RkSize index = 0ULL; index < internal::benchmark_fan_out_width; ++index)
+        {
+            pool.Schedule([&pending] {
+                internal::BenchmarkWork();
+                pending.fetch_sub(1ULL, std::memory_order_acq_rel);
+            });
+        }
+        internal::BenchmarkWaitFor(pending);
+    });
+
+    measure("DeepChain", internal::benchmark_chain_depth + 1ULL, [&] {
+        pending.store(internal::benchmark_chain_depth + 1ULL, std::memory_order_release);
+        pool.Schedule([&pool, &pending] { internal::BenchmarkLegacyChain(pool, pending); });
+        internal::BenchmarkWaitFor(pending);
+    });
+
+    internal::BenchmarkWorld world {};
+    measure("EcsFrame", internal::benchmark_ecs_frame_tasks, [&] {
+        for (RkSize phase = 0ULL; phase < internal::benchmark_ecs_phases; ++phase)
+        {
+            pending.store(internal::benchmark_ecs_axes * internal::benchmark_ecs_chunks, std::memory_order_release);
+            for (RkSize axis = 0ULL; axis < internal::benchmark_ecs_axes; ++axis)
+            {
+                for (RkSize chunk = 0ULL; chunk < internal::benchmark_ecs_chunks; ++chunk)
+                {
+                    pool.Schedule([&world, &pending, phase, axis, chunk] {
+                        internal::BenchmarkEcsChunk(world, phase, axis, chunk);
+                        pending.fetch_sub(1ULL, std::memory_order_acq_rel);
+                    });
+                }
+            }
+            internal::BenchmarkWaitFor(pending);
+        }
+    });
+}
+
+RkVoid ExecutiveBenchmarks::Run()
+{
+    m_results.clear();
+
+    for (RkSize workers = 1ULL; workers <= m_max_workers; ++workers)
+    {
+        RunExecutive(workers);
+        RunLegacy   (workers);
+    }
+}
+
+std::vector<ExecutiveBenchmarkResult> const& ExecutiveBenchmarks::GetResults() const noexcept
+{
+    return m_results;
+}
+
+RkVoid ExecutiveBenchmarks::DumpJson(std::ostream& inout_stream) const
+{
+    inout_stream << "{\"samples\":" << m_samples << ",\"results\":[";
+
+    for (RkSize index = 0ULL; index < m_results.size(); ++index)
+    {
+        ExecutiveBenchmarkResult const& result {m_results[index]};
+
+        inout_stream << (index == 0ULL ? "" : ",")
+            << "\n{\"scenario\":\""        << result.scenario
+            << "\",\"backend\":\""         << result.backend
+            << "\",\"workers\":"           << result.workers
+            << ",\"samples\":"             << result.samples
+            << ",\"tasks_per_sample\":"    << result.tasks_per_sample
+            << ",\"p50_us\":"              << result.p50_us
+            << ",\"p99_us\":"              << result.p99_us
+            << ",\"tasks_per_second\":"    << result.tasks_per_second << "}";
+    }
+
+    inout_stream << "\n]}\n";
+}
+
+RkBool ExecutiveBenchmarks::DumpJson(std::filesystem::path const& in_path) const
+{
+    std::ofstream file {in_path, std::ios::out | std::ios::trunc};
+    if (!file)
+        return false;
+
+    DumpJson(file);
+
+    return file.good();
+}
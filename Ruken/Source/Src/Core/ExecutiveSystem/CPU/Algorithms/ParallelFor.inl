@@ -0,0 +1,68 @@
+#pragma once
+
+template <QueueHandleType TQueueHandle>
+RkBool internal::IsQueueStarving() noexcept
+{
+    return TQueueHandle::GetInstance().GetConcurrencyCounter().optimal_concurrency == 0U;
+}
+
+template <QueueHandleType TQueueHandle, typename TIterator, typename TFunction>
+RkVoid internal::ParallelForRange(TIterator in_begin, TIterator in_end, RkSize const in_grain, TFunction& in_function, ParallelJoin& inout_join) noexcept
+{
+    try
+    {
+        while (in_begin != in_end && !inout_join.Failed())
+        {
+            RkSize const remaining {static_cast<RkSize>(in_end - in_begin)};
+
+            // Lazy binary splitting: the remaining work is only split when other workers might need it
+            if (remaining > in_grain && IsQueueStarving<TQueueHandle>())
+            {
+                TIterator const middle {in_begin + static_cast<std::iter_difference_t<TIterator>>(remaining / 2ULL)};
+
+                inout_join.Fork();
+                ParallelForPart<TQueueHandle>(middle, in_end, in_grain, in_function, inout_join);
+
+                in_end = middle;
+                continue;
+            }
+
+            TIterator const chunk_end {in_begin + static_cast<std::iter_difference_t<TIterator>>(std::min(remaining, in_grain))};
+            for (; in_begin != chunk_end; ++in_begin)
+                std::invoke(in_function, *in_begin);
+        }
+    }
+    catch (...)
+    {
+        inout_join.Fail(std::current_exception());
+        return;
+    }
+
+    inout_join.Complete();
+}
+
+template <QueueHandleType TQueueHandle, typename TIterator, typename TFunction>
+CPUTask<TQueueHandle> internal::ParallelForPart(TIterator in_begin, TIterator in_end, RkSize const in_grain, TFunction& in_function, ParallelJoin& inout_join) noexcept
+{
+    ParallelForRange<TQueueHandle>(in_begin, in_end, in_grain, in_function, inout_join);
+
+    co_return;
+}
+
+template <QueueHandleType TQueueHandle, std::ranges::view TView, typename TFunction>
+CPUTask<TQueueHandle> internal::ParallelForView(TView in_view, RkSize const in_grain, TFunction in_function)
+{
+    ParallelJoin join {};
+
+    // The calling task takes care of the first part itself
+    auto const begin {std::ranges::begin(in_view)};
+    ParallelForRange<TQueueHandle>(begin, begin + std::ranges::ssize(in_view), std::max<RkSize>(in_grain, 1ULL), in_function, join);
+
+    co_await join;
+}
+
+template <QueueHandleType TQueueHandle, ParallelRangeType TRange, typename TFunction>
+CPUTask<TQueueHandle> ParallelFor(TRange&& in_range, RkSize const in_grain, TFunction in_function)
+{
+    return internal::ParallelForView<TQueueHandle>(std::views::all(std::forward<TRange>(in_range)), in_grain, std::move(in_function));
+}
@@ -0,0 +1,29 @@
+#include "Core/ExecutiveSystem/CPU/Algorithms/ParallelJoin.hpp"
+
+USING_RUKEN_NAMESPACE
+
+RkVoid ParallelJoin::Fork() noexcept
+{
+    m_pending.fetch_add(1ULL, std::memory_order_relaxed);
+}
+
+RkVoid ParallelJoin::Complete() noexcept
+{
+    if (m_pending.fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+        SignalConsume();
+}
+
+RkVoid ParallelJoin::Fail(std::exception_ptr in_reason) noexcept
+{
+    // Only the first failing part gets to store its exception
+    RkBool expected {false};
+    if (m_failed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        Cancel(std::move(in_reason));
+
+    Complete();
+}
+
+RkBool ParallelJoin::Failed() const noexcept
+{
+    return m_failed.load(std::memory_order_relaxed);
+}
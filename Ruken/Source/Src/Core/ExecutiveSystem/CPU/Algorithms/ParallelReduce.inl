@@ -0,0 +1,100 @@
+#pragma once
+
+template <typename TValue, typename TOperation>
+RkVoid internal::ParallelReduceFold(ParallelReduceNode<TValue>* inout_node, TOperation& in_operation)
+{
+    // The last part of a subtree to complete is the only one touching its nodes from then on
+    while (inout_node && inout_node->pending.fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+    {
+        for (std::unique_ptr<ParallelReduceNode<TValue>> const& child: inout_node->children)
+            inout_node->value = std::invoke(in_operation, std::move(*inout_node->value), std::move(*child->value));
+
+        inout_node->children.clear();
+        inout_node = inout_node->parent;
+    }
+}
+
+template <QueueHandleType TQueueHandle, typename TIterator, typename TValue, typename TOperation>
+RkVoid internal::ParallelReduceRange(TIterator in_begin, TIterator in_end, RkSize const in_grain, TOperation& in_operation,
+                                     ParallelReduceNode<TValue>& inout_node, ParallelJoin& inout_join) noexcept
+{
+    try
+    {
+        // Parts are never empty, the first element is used to initialize the partial result
+        TValue partial {static_cast<TValue>(*in_begin)};
+        ++in_begin;
+
+        while (in_begin != in_end && !inout_join.Failed())
+        {
+            RkSize const remaining {static_cast<RkSize>(in_end - in_begin)};
+
+            // Lazy binary splitting: the remaining work is only split when other workers might need it
+            if (remaining > in_grain && IsQueueStarving<TQueueHandle>())
+            {
+                TIterator const middle {in_begin + static_cast<std::iter_difference_t<TIterator>>(remaining / 2ULL)};
+
+                ParallelReduceNode<TValue>& child {*inout_node.children.emplace_back(std::make_unique<ParallelReduceNode<TValue>>())};
+                child.parent = &inout_node;
+
+                inout_node.pending.fetch_add(1ULL, std::memory_order_relaxed);
+                inout_join.Fork();
+                ParallelReducePart<TQueueHandle>(middle, in_end, in_grain, in_operation, child, inout_join);
+
+                in_end = middle;
+                continue;
+            }
+
+            TIterator const chunk_end {in_begin + static_cast<std::iter_difference_t<TIterator>>(std::min(remaining, in_grain))};
+            for (; in_begin != chunk_end; ++in_begin)
+                partial = std::invoke(in_operation, std::move(partial), *in_begin);
+        }
+
+        // A failed reduction has no result, the join tree is left as is
+        if (!inout_join.Failed())
+        {
+            inout_node.value.emplace(std::move(partial));
+            ParallelReduceFold(&inout_node, in_operation);
+        }
+    }
+    catch (...)
+    {
+        inout_join.Fail(std::current_exception());
+        return;
+    }
+
+    inout_join.Complete();
+}
+
+template <QueueHandleType TQueueHandle, typename TIterator, typename TValue, typename TOperation>
+CPUTask<TQueueHandle> internal::ParallelReducePart(TIterator in_begin, TIterator in_end, RkSize const in_grain, TOperation& in_operation,
+                                                   ParallelReduceNode<TValue>& inout_node, ParallelJoin& inout_join) noexcept
+{
+    ParallelReduceRange<TQueueHandle>(in_begin, in_end, in_grain, in_operation, inout_node, inout_join);
+
+    co_return;
+}
+
+template <QueueHandleType TQueueHandle, std::ranges::view TView, typename TValue, typename TOperation>
+CPUTask<TQueueHandle, TValue> internal::ParallelReduceView(TView in_view, RkSize const in_grain, TValue in_init, TOperation in_operation)
+{
+    if (std::ranges::empty(in_view))
+        co_return in_init;
+
+    ParallelReduceNode<TValue> root {};
+    ParallelJoin               join {};
+
+    // The calling task takes care of the first part itself
+    auto const begin {std::ranges::begin(in_view)};
+    ParallelReduceRange<TQueueHandle>(begin, begin + std::ranges::ssize(in_view), std::max<RkSize>(in_grain, 1ULL), in_operation, root, join);
+
+    co_await join;
+
+    // Every part has been folded into the root at this point
+    co_return std::invoke(in_operation, std::move(in_init), std::move(*root.value));
+}
+
+template <QueueHandleType TQueueHandle, ParallelRangeType TRange, typename TValue, typename TOperation>
+CPUTask<TQueueHandle, TValue> ParallelReduce(TRange&& in_range, RkSize const in_grain, TValue in_init, TOperation in_operation)
+{
+    return internal::ParallelReduceView<TQueueHandle>(std::views::all(std::forward<TRange>(in_range)), in_grain, std::move(in_init), std::move(in_operation));
+}
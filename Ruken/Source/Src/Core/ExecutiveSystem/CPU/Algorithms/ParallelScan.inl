@@ -0,0 +1,52 @@
+#pragma once
+
+template <QueueHandleType TQueueHandle, std::ranges::view TView, std::random_access_iterator TOutputIterator, typename TOperation>
+CPUTask<TQueueHandle> internal::ParallelInclusiveScanView(TView in_view, TOutputIterator in_output, RkSize in_grain, TOperation in_operation)
+{
+    using Value = std::ranges::range_value_t<TView>;
+
+    RkSize const size {static_cast<RkSize>(std::ranges::size(in_view))};
+    if (size == 0ULL)
+        co_return;
+
+    in_grain = std::max<RkSize>(in_grain, 1ULL);
+
+    auto   const begin       {std::ranges::begin(in_view)};
+    RkSize const block_count {(size + in_grain - 1ULL) / in_grain};
+
+    // First pass, scanning every block independently
+    co_await ParallelFor<TQueueHandle>(std::views::iota(RkSize {0ULL}, block_count), 1ULL, [&](RkSize const in_block)
+    {
+        RkSize const first {in_block * in_grain};
+        RkSize const last  {std::min(first + in_grain, size)};
+
+        std::inclusive_scan(begin + first, begin + last, in_output + first, in_operation);
+    });
+
+    if (block_count == 1ULL)
+        co_return;
+
+    // Accumulating the offset of every block, the last element of each block holds its local sum
+    std::vector<Value> offsets {};
+    offsets.reserve(block_count - 1ULL);
+    offsets.emplace_back(in_output[in_grain - 1ULL]);
+
+    for (RkSize block = 1ULL; block < block_count - 1ULL; ++block)
+        offsets.emplace_back(std::invoke(in_operation, offsets.back(), in_output[(block + 1ULL) * in_grain - 1ULL]));
+
+    // Second pass, applying the offsets to every block but the first one
+    co_await ParallelFor<TQueueHandle>(std::views::iota(RkSize {1ULL}, block_count), 1ULL, [&](RkSize const in_block)
+    {
+        RkSize const first {in_block * in_grain};
+        RkSize const last  {std::min(first + in_grain, size)};
+
+        for (RkSize index = first; index < last; ++index)
+            in_output[index] = std::invoke(in_operation, offsets[in_block - 1ULL], in_output[index]);
+    });
+}
+
+template <QueueHandleType TQueueHandle, ParallelRangeType TRange, std::random_access_iterator TOutputIterator, typename TOperation>
+CPUTask<TQueueHandle> ParallelInclusiveScan(TRange&& in_range, TOutputIterator in_output, RkSize const in_grain, TOperation in_operation)
+{
+    return internal::ParallelInclusiveScanView<TQueueHandle>(std::views::all(std::forward<TRange>(in_range)), std::move(in_output), in_grain, std::move(in_operation));
+}
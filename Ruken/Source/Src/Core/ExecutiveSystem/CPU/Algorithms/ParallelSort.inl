@@ -0,0 +1,59 @@
+#pragma once
+
+template <QueueHandleType TQueueHandle, typename TIterator, typename TCompare>
+CPUTask<TQueueHandle> internal::ParallelSortPart(TIterator in_begin, TIterator in_end, RkSize const in_grain, TCompare& in_compare)
+{
+    RkSize const size {static_cast<RkSize>(in_end - in_begin)};
+
+    if (size <= in_grain)
+    {
+        std::sort(in_begin, in_end, std::ref(in_compare));
+        co_return;
+    }
+
+    TIterator const middle {in_begin + static_cast<std::iter_difference_t<TIterator>>(size / 2ULL)};
+
+    CPUTask<TQueueHandle> lower {ParallelSortPart<TQueueHandle>(in_begin, middle, in_grain, in_compare)};
+    CPUTask<TQueueHandle> upper {ParallelSortPart<TQueueHandle>(middle,   in_end, in_grain, in_compare)};
+
+    // Both halves are joined before any exception propagates, the other half would otherwise keep using the range and the comparison
+    std::exception_ptr exception {};
+
+    try
+    {
+        co_await lower;
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    try
+    {
+        co_await upper;
+    }
+    catch (...)
+    {
+        if (!exception)
+            exception = std::current_exception();
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+
+    std::inplace_merge(in_begin, middle, in_end, std::ref(in_compare));
+}
+
+template <QueueHandleType TQueueHandle, std::ranges::view TView, typename TCompare>
+CPUTask<TQueueHandle> internal::ParallelSortView(TView in_view, RkSize const in_grain, TCompare in_compare)
+{
+    auto const begin {std::ranges::begin(in_view)};
+
+    co_await ParallelSortPart<TQueueHandle>(begin, begin + std::ranges::ssize(in_view), std::max<RkSize>(in_grain, 2ULL), in_compare);
+}
+
+template <QueueHandleType TQueueHandle, ParallelRangeType TRange, typename TCompare>
+CPUTask<TQueueHandle> ParallelSort(TRange&& in_range, RkSize const in_grain, TCompare in_compare)
+{
+    return internal::ParallelSortView<TQueueHandle>(std::views::all(std::forward<TRange>(in_range)), in_grain, std::move(in_compare));
+}
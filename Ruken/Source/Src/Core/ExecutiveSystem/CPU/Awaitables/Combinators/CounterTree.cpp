@@ -0,0 +1,66 @@
+#include <algorithm>
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/CounterTree.hpp"
+
+USING_RUKEN_NAMESPACE
+
+RkVoid CounterTree::Node::OnAwaitedContinuation() noexcept
+{
+    if (count.fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+        parent->OnAwaitedContinuation();
+}
+
+RkSize CounterTree::Build(RkSize const in_children_count, CPUAwaiter& in_root) noexcept
+{
+    m_root = std::addressof(in_root);
+
+    // Small fan-ins are directly notifying the root
+    if (in_children_count <= fan_in)
+    {
+        m_nodes.reset();
+        return in_children_count;
+    }
+
+    // Counting the nodes of every level until the last one fits under the root
+    RkSize node_count {0ULL};
+    for (RkSize level_size = in_children_count; level_size > fan_in; node_count += level_size)
+        level_size = (level_size + fan_in - 1ULL) / fan_in;
+
+    m_nodes = std::make_unique<Node[]>(node_count);
+
+    // Linking every level to its parent, starting from the leaves
+    RkSize children_count {in_children_count};
+    RkSize level_begin    {0ULL};
+    RkSize level_size     {(in_children_count + fan_in - 1ULL) / fan_in};
+
+    while (true)
+    {
+        RkSize const parent_begin {level_begin + level_size};
+        RkSize const parent_size  {level_size > fan_in ? (level_size + fan_in - 1ULL) / fan_in : 0ULL};
+
+        for (RkSize index = 0ULL; index < level_size; ++index)
+        {
+            Node& node {m_nodes[level_begin + index]};
+
+            // Nodes are published to other threads once the continuations are attached, relaxed is enough here
+            node.count.store(std::min(fan_in, children_count - index * fan_in), std::memory_order_relaxed);
+            node.parent = parent_size > 0ULL ? std::addressof(m_nodes[parent_begin + index / fan_in]) : m_root;
+        }
+
+        // The last level fits under the root
+        if (parent_size == 0ULL)
+            return level_size;
+
+        children_count = level_size;
+        level_begin    = parent_begin;
+        level_size     = parent_size;
+    }
+}
+
+CPUAwaiter& CounterTree::GetLeaf(RkSize const in_child_index) const noexcept
+{
+    if (m_nodes)
+        return m_nodes[in_child_index / fan_in];
+
+    return *m_root;
+}
@@ -0,0 +1,181 @@
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/TaskGroup.hpp"
+
+USING_RUKEN_NAMESPACE
+
+RkVoid TaskGroup::Chunk::OnAwaitedContinuation() noexcept
+{
+    if (pending.fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+        group->OnAwaitedContinuation();
+}
+
+RkVoid TaskGroup::CancellationListener::OnAwaitedContinuation() noexcept
+{
+    group->OnCancelled();
+
+    // Releasing the listener count
+    group->OnAwaitedContinuation();
+}
+
+TaskGroup::TaskGroup() noexcept:
+    m_pending {2ULL},
+    m_linked  {false}
+{
+    m_head.group = this;
+}
+
+TaskGroup::TaskGroup(CancellationToken const& in_parent) noexcept:
+    m_pending {in_parent.CanBeCancelled() ? 3ULL : 2ULL},
+    m_linked  {in_parent.CanBeCancelled()},
+    m_source  {in_parent}
+{
+    m_head.group = this;
+
+    if (m_linked)
+        Listen();
+}
+
+RkVoid TaskGroup::Listen() noexcept
+{
+    m_listener.group = this;
+
+    // If the attachment failed, the group has been created from an already cancelled token
+    m_listener.continuation.Setup(m_listener, m_source.GetToken());
+    if (!m_listener.continuation.TryAttach())
+    {
+        m_cancelled.store(true);
+        OnAwaitedContinuation();
+    }
+}
+
+RkVoid TaskGroup::OnCancelled() noexcept
+{
+    m_cancelled.store(true);
+    if (m_joined.load())
+        DetachPending();
+}
+
+RkVoid TaskGroup::DetachPending() noexcept
+{
+    if (m_detached.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    for (Chunk* chunk = &m_head; chunk != nullptr; chunk = chunk->next.get())
+    {
+        for (RkSize index = 0ULL; index < chunk->size; ++index)
+        {
+            // A successful detach guarantees the task will never notify the chunk
+            if (chunk->continuations[index].Detach())
+            {
+                chunk->detached.set(index);
+                chunk->OnAwaitedContinuation();
+            }
+        }
+    }
+}
+
+RkVoid TaskGroup::Spawn(CPUAwaitableHandle<RkVoid, false> const& in_task) noexcept
+{
+    // Opening a new chunk and sealing the current one when full.
+    // The new chunk has to be accounted for before the seal is released.
+    if (m_tail->size == chunk_capacity)
+    {
+        m_pending.fetch_add(1ULL, std::memory_order_acq_rel);
+
+        Chunk& sealed {*m_tail};
+
+        sealed.next        = std::make_unique<Chunk>();
+        sealed.next->group = this;
+        m_tail             = sealed.next.get();
+
+        sealed.OnAwaitedContinuation();
+    }
+
+    CPUPropagatingContinuation<RkVoid, false>& continuation {m_tail->continuations[m_tail->size++]};
+
+    m_tail->pending.fetch_add(1ULL, std::memory_order_acq_rel);
+
+    // If the attachment failed, that means the task has already been completed
+    continuation.Setup(*m_tail, in_task);
+    if (!continuation.TryAttach())
+        m_tail->OnAwaitedContinuation();
+}
+
+TaskGroup& TaskGroup::Join() noexcept
+{
+    if (!m_joined.load(std::memory_order_relaxed))
+    {
+        m_joined.store(true);
+
+        // The join count is still held, the group cannot complete during the pass
+        if (m_cancelled.load())
+            DetachPending();
+
+        // Releasing the seal of the last chunk as well as the join count
+        m_tail->OnAwaitedContinuation();
+        OnAwaitedContinuation();
+    }
+
+    return *this;
+}
+
+RkVoid TaskGroup::RequestCancellation() noexcept
+{
+    m_source.RequestCancellation();
+
+    // Linked groups are notified by their listener, the same way as for a cancellation of the parent
+    if (m_linked)
+        return;
+
+    // Holding a count for the pass, unless the group has already completed
+    RkSize pending {m_pending.load(std::memory_order_acquire)};
+    do
+    {
+        if (pending == 0ULL)
+            return;
+    }
+    while (!m_pending.compare_exchange_weak(pending, pending + 1ULL, std::memory_order_acq_rel));
+
+    OnCancelled();
+    OnAwaitedContinuation();
+}
+
+CancellationToken TaskGroup::GetToken() const noexcept
+{
+    return m_source.GetToken();
+}
+
+RkVoid TaskGroup::OnAwaitedContinuation() noexcept
+{
+    RkSize const previous {m_pending.fetch_sub(1ULL, std::memory_order_acq_rel)};
+
+    // If the listener holds the last count, it is detached so the group can complete.
+    // Otherwise the detach fails and the listener releases its count by itself once notified.
+    if (m_linked && previous == 2ULL)
+    {
+        if (m_listener.continuation.Detach())
+            OnAwaitedContinuation();
+        return;
+    }
+
+    if (previous != 1ULL)
+        return;
+
+    // Every task has been completed, propagating the first exception found if any
+    for (Chunk const* chunk = &m_head; chunk != nullptr; chunk = chunk->next.get())
+    {
+        for (RkSize index = 0ULL; index < chunk->size; ++index)
+        {
+            if (chunk->detached[index])
+                continue;
+
+            if (std::exception_ptr const exception = chunk->continuations[index].GetException())
+            {
+                Cancel(exception);
+                SignalConsume();
+                return;
+            }
+        }
+    }
+
+    SignalConsume();
+}
@@ -0,0 +1,9 @@
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/WhenAll.hpp"
+
+USING_RUKEN_NAMESPACE
+
+RkVoid WhenAll::OnAwaitedContinuation() noexcept
+{
+    if (m_count.fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+        SignalConsume();
+}
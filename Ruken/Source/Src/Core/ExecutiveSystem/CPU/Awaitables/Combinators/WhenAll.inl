@@ -0,0 +1,39 @@
+#pragma once
+
+#pragma region Lifetime
+
+template <std::ranges::sized_range TRange>
+WhenAll::WhenAll(TRange const& in_handles) noexcept
+{
+    RkSize const count {static_cast<RkSize>(std::ranges::size(in_handles))};
+
+    // The extra count is held during the attachment process to make
+    // sure the completion cannot be signaled before every continuation has been set up
+    m_count.store(m_tree.Build(count, *this) + 1ULL, std::memory_order_release);
+
+    CPUContinuation* continuations {m_inline_continuations.data()};
+    if (count > inline_capacity)
+    {
+        m_continuations = std::make_unique<CPUContinuation[]>(count);
+        continuations   = m_continuations.get();
+    }
+
+    RkSize index {0ULL};
+    for (auto const& handle: in_handles)
+    {
+        CPUAwaiter& leaf {m_tree.GetLeaf(index)};
+
+        // If the attachment failed, that means the awaited event has already been completed.
+        // Thus we need to count it down manually.
+        continuations[index].Setup(leaf, handle);
+        if (!continuations[index].TryAttach())
+            leaf.OnAwaitedContinuation();
+
+        ++index;
+    }
+
+    // Releasing the extra count
+    OnAwaitedContinuation();
+}
+
+#pragma endregion
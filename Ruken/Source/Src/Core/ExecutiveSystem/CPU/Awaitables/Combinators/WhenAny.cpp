@@ -0,0 +1,37 @@
+#include <atomic_queue/atomic_queue.h>
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Combinators/WhenAny.hpp"
+
+USING_RUKEN_NAMESPACE
+
+RkVoid WhenAny::Arm::OnAwaitedContinuation() noexcept
+{
+    owner->Complete(index);
+
+    // Past this point, the owner is free to destroy the arm
+    notified.store(true, std::memory_order_release);
+}
+
+WhenAny::~WhenAny() noexcept
+{
+    for (RkSize index = 0ULL; index < m_arm_count; ++index)
+    {
+        Arm& arm {m_arms[index]};
+
+        // If the arm could not be detached, its awaitable is being (or has been) signaled.
+        // Waiting for the notification to be over before releasing the memory of the arm.
+        if (!arm.continuation.Detach())
+            while (!arm.notified.load(std::memory_order_acquire))
+                atomic_queue::spin_loop_pause();
+    }
+}
+
+RkVoid WhenAny::Complete(RkSize const in_index) noexcept
+{
+    RkBool expected {false};
+    if (!m_completed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        return;
+
+    m_result = in_index;
+    SignalConsume();
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#pragma region Lifetime
+
+template <std::ranges::sized_range TRange>
+WhenAny::WhenAny(TRange const& in_handles) noexcept:
+    m_arms      {m_inline_arms.data()},
+    m_arm_count {static_cast<RkSize>(std::ranges::size(in_handles))}
+{
+    if (m_arm_count == 0ULL)
+    {
+        Complete(none);
+        return;
+    }
+
+    if (m_arm_count > inline_capacity)
+    {
+        m_heap_arms = std::make_unique<Arm[]>(m_arm_count);
+        m_arms      = m_heap_arms.get();
+    }
+
+    RkSize index {0ULL};
+    for (auto const& handle: in_handles)
+    {
+        Arm& arm {m_arms[index]};
+
+        arm.owner = this;
+        arm.index = index++;
+
+        // If the attachment failed, that means the awaited event has already been completed
+        arm.continuation.Setup(arm, handle);
+        if (!arm.continuation.TryAttach())
+            arm.OnAwaitedContinuation();
+    }
+}
+
+#pragma endregion
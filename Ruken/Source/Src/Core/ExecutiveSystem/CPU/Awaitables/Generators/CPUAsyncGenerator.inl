@@ -0,0 +1,147 @@
+#pragma once
+
+#pragma region promise_type
+
+template <QueueHandleType TQueueHandle, typename TType>
+std::coroutine_handle<> CPUAsyncGenerator<TQueueHandle, TType>::promise_type::HandOver() noexcept
+{
+    // The consumer might destroy the generator as soon as it is notified, nothing can be read past this point
+    CPUAwaiter& consumer {*std::exchange(m_consumer, nullptr)};
+
+    // Same as a completing task, the consumer is resumed in place if it lives on the current queue
+    WorkerInfo::transfer_allowed = WorkerInfo::transfer_depth < RUKEN_CPU_SYMMETRIC_TRANSFER_MAX_DEPTH;
+    consumer.OnAwaitedContinuation();
+    WorkerInfo::transfer_allowed = false;
+
+    std::coroutine_handle<> const continuation {std::exchange(WorkerInfo::transfer_continuation, nullptr)};
+    if (!continuation)
+        return std::noop_coroutine();
+
+    ++WorkerInfo::transfer_depth;
+
+    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Transfer, continuation.address(), WorkerInfo::current_queue);
+
+    return continuation;
+}
+
+template <QueueHandleType TQueueHandle, typename TType>
+typename CPUAsyncGenerator<TQueueHandle, TType>::promise_type::HandOverAwaiter CPUAsyncGenerator<TQueueHandle, TType>::promise_type::final_suspend() noexcept
+{
+    m_done = true;
+
+    return HandOverAwaiter {{}, *this};
+}
+
+template <QueueHandleType TQueueHandle, typename TType>
+typename CPUAsyncGenerator<TQueueHandle, TType>::promise_type::HandOverAwaiter CPUAsyncGenerator<TQueueHandle, TType>::promise_type::yield_value(TType in_value) noexcept(std::is_nothrow_move_constructible_v<TType>)
+{
+    m_value.emplace(std::move(in_value));
+
+    return HandOverAwaiter {{}, *this};
+}
+
+#pragma endregion
+
+#pragma region NextAwaiter
+
+template <QueueHandleType TQueueHandle, typename TType>
+CPUAsyncGenerator<TQueueHandle, TType>::NextAwaiter::NextAwaiter(CPUAsyncGenerator& in_generator) noexcept:
+    m_generator {in_generator}
+{}
+
+template <QueueHandleType TQueueHandle, typename TType>
+RkBool CPUAsyncGenerator<TQueueHandle, TType>::NextAwaiter::await_ready() const noexcept
+{
+    return m_generator.m_handle.promise().m_done;
+}
+
+template <QueueHandleType TQueueHandle, typename TType>
+template <typename TPromise>
+std::coroutine_handle<> CPUAsyncGenerator<TQueueHandle, TType>::NextAwaiter::await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept
+{
+    static_assert(std::is_base_of_v<CPUAwaiter, TPromise>, "Only CPU tasks can await an async generator");
+
+    std::coroutine_handle<promise_type> const producer {m_generator.m_handle};
+    CentralProcessingQueue&                   queue    {TQueueHandle::GetInstance()};
+
+    producer.promise().m_consumer = std::addressof(static_cast<CPUAwaiter&>(in_handle.promise()));
+    producer.promise().m_queue    = std::addressof(queue);
+
+    // The producer runs in place when it shares the queue of the consumer, saving a round trip through the queue
+    if (WorkerInfo::transfer_depth < RUKEN_CPU_SYMMETRIC_TRANSFER_MAX_DEPTH && WorkerInfo::current_queue == &queue)
+    {
+        ++WorkerInfo::transfer_depth;
+
+        RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Transfer, producer.address(), WorkerInfo::current_queue);
+
+        return producer;
+    }
+
+    queue.Push(producer);
+
+    return std::noop_coroutine();
+}
+
+template <QueueHandleType TQueueHandle, typename TType>
+std::optional<TType> CPUAsyncGenerator<TQueueHandle, TType>::NextAwaiter::await_resume() const
+{
+    promise_type& promise {m_generator.m_handle.promise()};
+
+    if (promise.m_exception)
+        std::rethrow_exception(std::exchange(promise.m_exception, nullptr));
+
+    std::optional<TType> value {std::move(promise.m_value)};
+    promise.m_value.reset();
+
+    return value;
+}
+
+#pragma endregion
+
+#pragma region CPUAsyncGenerator
+
+template <QueueHandleType TQueueHandle, typename TType>
+CPUAsyncGenerator<TQueueHandle, TType>::CPUAsyncGenerator(std::coroutine_handle<promise_type> in_handle) noexcept:
+    m_handle {in_handle}
+{}
+
+template <QueueHandleType TQueueHandle, typename TType>
+CPUAsyncGenerator<TQueueHandle, TType>::CPUAsyncGenerator(CPUAsyncGenerator&& in_move) noexcept:
+    m_handle {std::exchange(in_move.m_handle, nullptr)}
+{}
+
+template <QueueHandleType TQueueHandle, typename TType>
+CPUAsyncGenerator<TQueueHandle, TType>::~CPUAsyncGenerator() noexcept
+{
+    // The producer is always suspended when no value is awaited, it can be destroyed at any of its suspension points
+    if (m_handle)
+        m_handle.destroy();
+}
+
+template <QueueHandleType TQueueHandle, typename TType>
+CPUAsyncGenerator<TQueueHandle, TType>& CPUAsyncGenerator<TQueueHandle, TType>::operator=(CPUAsyncGenerator&& in_move) noexcept
+{
+    if (this != std::addressof(in_move))
+    {
+        if (m_handle)
+            m_handle.destroy();
+
+        m_handle = std::exchange(in_move.m_handle, nullptr);
+    }
+
+    return *this;
+}
+
+template <QueueHandleType TQueueHandle, typename TType>
+typename CPUAsyncGenerator<TQueueHandle, TType>::NextAwaiter CPUAsyncGenerator<TQueueHandle, TType>::Next() noexcept
+{
+    return NextAwaiter {*this};
+}
+
+template <QueueHandleType TQueueHandle, typename TType>
+RkBool CPUAsyncGenerator<TQueueHandle, TType>::Done() const noexcept
+{
+    return m_handle.promise().m_done;
+}
+
+#pragma endregion
@@ -0,0 +1,43 @@
+#include <new>
+
+#include "Core/ExecutiveSystem/CPU/IO/FileHandle.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/IO/AsyncReadFile.hpp"
+
+USING_RUKEN_NAMESPACE
+
+AsyncReadFile::AsyncReadFile(std::filesystem::path in_path, std::vector<RkByte>& out_buffer) noexcept:
+    m_path   {std::move(in_path)},
+    m_buffer {out_buffer}
+{}
+
+RkVoid AsyncReadFile::Execute() noexcept
+{
+    FileHandle const file {m_path, EFileAccess::Read};
+
+    if (!file.IsOpen())
+    {
+        m_buffer.clear();
+        return;
+    }
+
+    // Execute cannot throw, a file too large to be buffered is reported as a failed read
+    try
+    {
+        m_buffer.resize(file.GetSize());
+    }
+    catch (std::bad_alloc const&)
+    {
+        m_buffer.clear();
+        return;
+    }
+
+    RkSize const read {file.ReadAt(0ULL, m_buffer)};
+
+    m_result = read == m_buffer.size();
+    m_buffer.resize(read);
+}
+
+RkBool AsyncReadFile::await_resume() const noexcept
+{
+    return m_result;
+}
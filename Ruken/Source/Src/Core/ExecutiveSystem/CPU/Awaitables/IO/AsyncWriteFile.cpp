@@ -0,0 +1,21 @@
+#include "Core/ExecutiveSystem/CPU/IO/FileHandle.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/IO/AsyncWriteFile.hpp"
+
+USING_RUKEN_NAMESPACE
+
+AsyncWriteFile::AsyncWriteFile(std::filesystem::path in_path, std::span<RkByte const> const in_data) noexcept:
+    m_path {std::move(in_path)},
+    m_data {in_data}
+{}
+
+RkVoid AsyncWriteFile::Execute() noexcept
+{
+    FileHandle const file {m_path, EFileAccess::Write};
+
+    m_result = file.IsOpen() && file.WriteAt(0ULL, m_data) == m_data.size();
+}
+
+RkBool AsyncWriteFile::await_resume() const noexcept
+{
+    return m_result;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+template <std::invocable TFunction>
+OffloadBlocking<TFunction>::OffloadBlocking(TFunction in_function) noexcept(std::is_nothrow_move_constructible_v<TFunction>):
+    m_function {std::move(in_function)}
+{}
+
+template <std::invocable TFunction>
+RkVoid OffloadBlocking<TFunction>::Execute() noexcept
+{
+    try
+    {
+        if constexpr (std::is_void_v<Result>)
+            std::invoke(m_function);
+        else
+            m_result.emplace(std::invoke(m_function));
+    }
+    catch (...)
+    {
+        m_exception = std::current_exception();
+    }
+}
+
+template <std::invocable TFunction>
+typename OffloadBlocking<TFunction>::Result OffloadBlocking<TFunction>::await_resume()
+{
+    if (m_exception)
+        std::rethrow_exception(m_exception);
+
+    if constexpr (!std::is_void_v<Result>)
+        return std::move(*m_result);
+}
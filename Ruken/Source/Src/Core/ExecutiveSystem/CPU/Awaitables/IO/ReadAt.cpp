@@ -0,0 +1,19 @@
+#include "Core/ExecutiveSystem/CPU/Awaitables/IO/ReadAt.hpp"
+
+USING_RUKEN_NAMESPACE
+
+ReadAt::ReadAt(FileHandle const& in_file, RkSize const in_offset, std::span<RkByte> const out_buffer) noexcept:
+    m_file   {in_file},
+    m_offset {in_offset},
+    m_buffer {out_buffer}
+{}
+
+RkVoid ReadAt::Execute() noexcept
+{
+    m_result = m_file.ReadAt(m_offset, m_buffer);
+}
+
+RkSize ReadAt::await_resume() const noexcept
+{
+    return m_result;
+}
@@ -0,0 +1,86 @@
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncMutex.hpp"
+
+USING_RUKEN_NAMESPACE
+
+AsyncMutex::LockAwaiter::LockAwaiter(AsyncMutex& in_mutex) noexcept:
+    m_mutex {in_mutex}
+{}
+
+RkBool AsyncMutex::LockAwaiter::await_ready() const noexcept
+{
+    return m_mutex.TryLock();
+}
+
+RkBool AsyncMutex::LockAwaiter::Suspend(CPUAwaiter& inout_owner) noexcept
+{
+    m_continuation.hook  = std::addressof(m_mutex.m_state);
+    m_continuation.owner = std::addressof(inout_owner);
+
+    while (true)
+    {
+        // Attaching only fails if the mutex has been unlocked in the meantime, in which case we can attempt to acquire it again
+        if (m_mutex.TryLock())
+            return false;
+
+        // The task might be resumed by another worker as soon as it is attached,
+        // "this" must not be accessed past this point.
+        if (m_continuation.TryAttach())
+            return true;
+    }
+}
+
+AsyncMutex& AsyncMutex::LockAwaiter::GetMutex() const noexcept
+{
+    return m_mutex;
+}
+
+AsyncMutexLock AsyncMutex::ScopedLockAwaiter::await_resume() const noexcept
+{
+    return AsyncMutexLock {GetMutex()};
+}
+
+RkBool AsyncMutex::TryLock() noexcept
+{
+    CPUContinuation* expected {CPUContinuation::consumed};
+
+    return m_state.compare_exchange_strong(expected, nullptr, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+AsyncMutex::LockAwaiter AsyncMutex::Lock() noexcept
+{
+    return LockAwaiter {*this};
+}
+
+AsyncMutex::ScopedLockAwaiter AsyncMutex::ScopedLock() noexcept
+{
+    return ScopedLockAwaiter {*this};
+}
+
+RkVoid AsyncMutex::Unlock() noexcept
+{
+    if (m_waiters == nullptr)
+    {
+        // Nobody is waiting, simply unlocking the mutex
+        CPUContinuation* expected {nullptr};
+        if (m_state.compare_exchange_strong(expected, CPUContinuation::consumed, std::memory_order_release, std::memory_order_relaxed))
+            return;
+
+        // Otherwise, collecting the newly attached waiters while keeping the mutex locked,
+        // and reversing them to resume them in arrival order
+        CPUContinuation* waiter {m_state.exchange(nullptr, std::memory_order_acquire)};
+
+        while (waiter)
+        {
+            CPUContinuation* const next {waiter->next.load(std::memory_order_relaxed)};
+
+            waiter->next.store(m_waiters, std::memory_order_relaxed);
+            m_waiters = std::exchange(waiter, next);
+        }
+    }
+
+    // Handing the mutex over to the next waiter
+    CPUContinuation* const next_owner {m_waiters};
+    m_waiters = next_owner->next.load(std::memory_order_relaxed);
+
+    next_owner->owner->OnAwaitedContinuation();
+}
@@ -0,0 +1,111 @@
+#include <atomic_queue/atomic_queue.h>
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncSemaphore.hpp"
+
+USING_RUKEN_NAMESPACE
+
+AsyncSemaphore::AcquireAwaiter::AcquireAwaiter(AsyncSemaphore& in_semaphore) noexcept:
+    m_semaphore {in_semaphore}
+{}
+
+RkBool AsyncSemaphore::AcquireAwaiter::await_ready() const noexcept
+{
+    return m_semaphore.TryAcquire();
+}
+
+RkBool AsyncSemaphore::AcquireAwaiter::Suspend(CPUAwaiter& inout_owner) noexcept
+{
+    m_continuation.owner = std::addressof(inout_owner);
+
+    m_semaphore.LockWaiters();
+
+    // Permits are only made available while nobody is waiting,
+    // checking again under the guard ensures no release can be missed
+    if (m_semaphore.TryAcquire())
+    {
+        m_semaphore.UnlockWaiters();
+        return false;
+    }
+
+    m_semaphore.m_waiters.Push(m_continuation);
+    m_semaphore.UnlockWaiters();
+
+    return true;
+}
+
+AsyncSemaphore& AsyncSemaphore::AcquireAwaiter::GetSemaphore() const noexcept
+{
+    return m_semaphore;
+}
+
+AsyncSemaphorePermit AsyncSemaphore::ScopedAcquireAwaiter::await_resume() const noexcept
+{
+    return AsyncSemaphorePermit {GetSemaphore()};
+}
+
+AsyncSemaphore::AsyncSemaphore(RkSize const in_initial_count) noexcept:
+    m_count {in_initial_count}
+{}
+
+RkVoid AsyncSemaphore::LockWaiters() noexcept
+{
+    while (m_guard.test_and_set(std::memory_order_acquire))
+        atomic_queue::spin_loop_pause();
+}
+
+RkVoid AsyncSemaphore::UnlockWaiters() noexcept
+{
+    m_guard.clear(std::memory_order_release);
+}
+
+RkBool AsyncSemaphore::TryAcquire() noexcept
+{
+    RkSize count {m_count.load(std::memory_order_relaxed)};
+
+    do
+    {
+        if (count == 0ULL)
+            return false;
+    } while (!m_count.compare_exchange_weak(count, count - 1ULL, std::memory_order_acquire, std::memory_order_relaxed));
+
+    return true;
+}
+
+AsyncSemaphore::AcquireAwaiter AsyncSemaphore::Acquire() noexcept
+{
+    return AcquireAwaiter {*this};
+}
+
+AsyncSemaphore::ScopedAcquireAwaiter AsyncSemaphore::ScopedAcquire() noexcept
+{
+    return ScopedAcquireAwaiter {*this};
+}
+
+RkVoid AsyncSemaphore::Release() noexcept
+{
+    Release(1ULL);
+}
+
+RkVoid AsyncSemaphore::Release(RkSize in_count) noexcept
+{
+    CPUContinuationQueue resumed {};
+
+    LockWaiters();
+
+    // Handing the permits over to the waiting tasks first
+    for (; in_count > 0ULL && !m_waiters.Empty(); --in_count)
+        resumed.Push(*m_waiters.Pop());
+
+    m_count.fetch_add(in_count, std::memory_order_release);
+
+    UnlockWaiters();
+
+    // Resumed tasks might complete and destroy their continuation as soon as they are notified
+    while (CPUContinuation* const continuation {resumed.Pop()})
+        continuation->owner->OnAwaitedContinuation();
+}
+
+RkSize AsyncSemaphore::GetAvailableCount() const noexcept
+{
+    return m_count.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,174 @@
+#include <atomic_queue/atomic_queue.h>
+
+#include "Core/ExecutiveSystem/CPU/Awaitables/Primitives/AsyncSharedMutex.hpp"
+
+USING_RUKEN_NAMESPACE
+
+AsyncSharedMutex::LockAwaiter::LockAwaiter(AsyncSharedMutex& in_mutex, RkBool const in_shared) noexcept:
+    m_mutex  {in_mutex},
+    m_shared {in_shared}
+{}
+
+RkBool AsyncSharedMutex::LockAwaiter::await_ready() const noexcept
+{
+    return m_shared ? m_mutex.TryLockShared() : m_mutex.TryLock();
+}
+
+RkBool AsyncSharedMutex::LockAwaiter::Suspend(CPUAwaiter& inout_owner) noexcept
+{
+    m_continuation.owner = std::addressof(inout_owner);
+
+    m_mutex.LockState();
+
+    // The mutex might have been released since await_ready
+    if (m_mutex.TryLockUnsafe(m_shared))
+    {
+        m_mutex.UnlockState();
+        return false;
+    }
+
+    (m_shared ? m_mutex.m_waiting_readers : m_mutex.m_waiting_writers).Push(m_continuation);
+    m_mutex.UnlockState();
+
+    return true;
+}
+
+AsyncSharedMutex& AsyncSharedMutex::LockAwaiter::GetMutex() const noexcept
+{
+    return m_mutex;
+}
+
+AsyncSharedMutex::ScopedLockAwaiter::ScopedLockAwaiter(AsyncSharedMutex& in_mutex) noexcept:
+    LockAwaiter {in_mutex, false}
+{}
+
+AsyncSharedMutexWriteLock AsyncSharedMutex::ScopedLockAwaiter::await_resume() const noexcept
+{
+    return AsyncSharedMutexWriteLock {GetMutex()};
+}
+
+AsyncSharedMutex::ScopedLockSharedAwaiter::ScopedLockSharedAwaiter(AsyncSharedMutex& in_mutex) noexcept:
+    LockAwaiter {in_mutex, true}
+{}
+
+AsyncSharedMutexReadLock AsyncSharedMutex::ScopedLockSharedAwaiter::await_resume() const noexcept
+{
+    return AsyncSharedMutexReadLock {GetMutex()};
+}
+
+RkVoid AsyncSharedMutex::LockState() noexcept
+{
+    while (m_guard.test_and_set(std::memory_order_acquire))
+        atomic_queue::spin_loop_pause();
+}
+
+RkVoid AsyncSharedMutex::UnlockState() noexcept
+{
+    m_guard.clear(std::memory_order_release);
+}
+
+RkBool AsyncSharedMutex::TryLockUnsafe(RkBool const in_shared) noexcept
+{
+    if (m_writer)
+        return false;
+
+    // Readers are not allowed to overtake waiting writers
+    if (in_shared)
+    {
+        if (!m_waiting_writers.Empty())
+            return false;
+
+        m_readers++;
+        return true;
+    }
+
+    if (m_readers != 0ULL)
+        return false;
+
+    m_writer = true;
+    return true;
+}
+
+RkBool AsyncSharedMutex::TryLock() noexcept
+{
+    LockState();
+    RkBool const acquired {TryLockUnsafe(false)};
+    UnlockState();
+
+    return acquired;
+}
+
+RkBool AsyncSharedMutex::TryLockShared() noexcept
+{
+    LockState();
+    RkBool const acquired {TryLockUnsafe(true)};
+    UnlockState();
+
+    return acquired;
+}
+
+AsyncSharedMutex::LockAwaiter AsyncSharedMutex::Lock() noexcept
+{
+    return LockAwaiter {*this, false};
+}
+
+AsyncSharedMutex::LockAwaiter AsyncSharedMutex::LockShared() noexcept
+{
+    return LockAwaiter {*this, true};
+}
+
+AsyncSharedMutex::ScopedLockAwaiter AsyncSharedMutex::ScopedLock() noexcept
+{
+    return ScopedLockAwaiter {*this};
+}
+
+AsyncSharedMutex::ScopedLockSharedAwaiter AsyncSharedMutex::ScopedLockShared() noexcept
+{
+    return ScopedLockSharedAwaiter {*this};
+}
+
+RkVoid AsyncSharedMutex::Unlock() noexcept
+{
+    CPUContinuationQueue resumed {};
+
+    LockState();
+
+    m_writer = false;
+
+    // Waiting readers go first, otherwise a steady flow of writers would starve them
+    while (!m_waiting_readers.Empty())
+    {
+        resumed.Push(*m_waiting_readers.Pop());
+        m_readers++;
+    }
+
+    if (m_readers == 0ULL && !m_waiting_writers.Empty())
+    {
+        resumed.Push(*m_waiting_writers.Pop());
+        m_writer = true;
+    }
+
+    UnlockState();
+
+    // Resumed tasks might complete and destroy their continuation as soon as they are notified
+    while (CPUContinuation* const continuation {resumed.Pop()})
+        continuation->owner->OnAwaitedContinuation();
+}
+
+RkVoid AsyncSharedMutex::UnlockShared() noexcept
+{
+    CPUContinuation* next_writer {nullptr};
+
+    LockState();
+
+    if (--m_readers == 0ULL && !m_waiting_writers.Empty())
+    {
+        next_writer = m_waiting_writers.Pop();
+        m_writer    = true;
+    }
+
+    UnlockState();
+
+    if (next_writer)
+        next_writer->owner->OnAwaitedContinuation();
+}
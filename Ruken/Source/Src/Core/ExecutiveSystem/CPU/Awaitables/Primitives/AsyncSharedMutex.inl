@@ -0,0 +1,9 @@
+#pragma once
+
+template <typename TPromise>
+RkBool AsyncSharedMutex::LockAwaiter::await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept
+{
+    static_assert(std::is_base_of_v<CPUAwaiter, TPromise>, "Only CPU tasks can await an async shared mutex");
+
+    return Suspend(static_cast<CPUAwaiter&>(in_handle.promise()));
+}
@@ -0,0 +1,7 @@
+#include "Core/ExecutiveSystem/CPU/Awaitables/Timers/Delay.hpp"
+
+USING_RUKEN_NAMESPACE
+
+Delay::Delay(Milliseconds const in_duration) noexcept:
+    Delay {std::chrono::duration<RkFloat, std::milli>(static_cast<RkFloat>(in_duration))}
+{}
@@ -0,0 +1,6 @@
+#pragma once
+
+template <typename TRep, typename TPeriod>
+Delay::Delay(std::chrono::duration<TRep, TPeriod> const in_duration) noexcept:
+    Until {CPUTimerWheel::Clock::now() + std::chrono::ceil<CPUTimerWheel::Clock::duration>(in_duration)}
+{}
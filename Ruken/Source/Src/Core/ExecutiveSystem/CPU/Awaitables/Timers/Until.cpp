@@ -0,0 +1,12 @@
+#include "Core/ExecutiveSystem/CPU/Awaitables/Timers/Until.hpp"
+
+USING_RUKEN_NAMESPACE
+
+Until::Until(CPUTimerWheel::TimePoint const in_time_point) noexcept:
+    m_time_point {in_time_point}
+{}
+
+RkBool Until::await_ready() const noexcept
+{
+    return CPUTimerWheel::Clock::now() >= m_time_point;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+template <typename TPromise>
+RkVoid Until::await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept
+{
+    static_assert(std::is_base_of_v<CPUAwaiter, TPromise>, "Only CPU tasks can await timers");
+
+    CPUTimerWheel& wheel {CPUTimerWheel::GetInstance()};
+
+    m_timer.owner    = &static_cast<CPUAwaiter&>(in_handle.promise());
+    m_timer.deadline = wheel.ToDeadline(m_time_point);
+
+    // The task might be resumed by another worker as soon as the timer is armed,
+    // "this" must not be accessed past this point.
+    wheel.Arm(m_timer);
+}
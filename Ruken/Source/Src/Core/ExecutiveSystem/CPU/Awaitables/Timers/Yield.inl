@@ -0,0 +1,11 @@
+#pragma once
+
+template <typename TPromise>
+RkVoid Yield::await_suspend(std::coroutine_handle<TPromise> in_handle) const noexcept
+{
+    static_assert(std::is_base_of_v<CPUAwaiter, TPromise>, "Only CPU tasks can yield");
+
+    // Symmetric transfers are only allowed while a task completes, the task always goes through its queue here.
+    // It might be resumed by another worker right away, "this" must not be accessed past this point.
+    static_cast<CPUAwaiter&>(in_handle.promise()).OnAwaitedContinuation();
+}
@@ -0,0 +1,59 @@
+#include <algorithm>
+
+#include "Core/ExecutiveSystem/CPU/CPUParkingLot.hpp"
+#include "Core/ExecutiveSystem/CPU/Timers/CPUTimerWheel.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CentralProcessingQueue.hpp"
+
+USING_RUKEN_NAMESPACE
+
+CPUParkingLot& CPUParkingLot::GetInstance() noexcept
+{
+    static CPUParkingLot instance;
+
+    return instance;
+}
+
+RkVoid CPUParkingLot::Park(std::vector<CentralProcessingQueue*> const& in_queues,
+                           std::stop_token                      const& in_stop_token,
+                           std::atomic<RkSize>                  const* in_counter,
+                           Clock::time_point                    const  in_deadline) noexcept
+{
+    CPUTimerWheel& timer_wheel {CPUTimerWheel::GetInstance()};
+
+    std::unique_lock lock {m_mutex};
+
+    m_parked.fetch_add(1ULL, std::memory_order_relaxed);
+
+    // Pairs with the fence of Notify: either the notifier sees this thread parked, or this thread sees what has been notified
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    Clock::time_point const deadline {std::min(in_deadline, timer_wheel.GetNextExpiry())};
+
+    auto const should_wake = [&] {
+        return (in_counter && in_counter->load(std::memory_order_acquire) == 0ULL)
+            || std::ranges::any_of(in_queues, [](CentralProcessingQueue const* in_queue) { return in_queue->GetDepth() > 0ULL; })
+            || timer_wheel.GetNextExpiry() < deadline;
+    };
+
+    if (deadline == Clock::time_point::max())
+        m_notification.wait(lock, in_stop_token, should_wake);
+    else
+        m_notification.wait_until(lock, in_stop_token, deadline, should_wake);
+
+    m_parked.fetch_sub(1ULL, std::memory_order_relaxed);
+}
+
+RkVoid CPUParkingLot::Notify() noexcept
+{
+    // Pairs with the fence of Park
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_parked.load(std::memory_order_relaxed) == 0ULL)
+        return;
+
+    // Threads registered as parked are either waiting or still checking their conditions under the lock,
+    // taking it guarantees that none of them can go to sleep right after the notification
+    { std::lock_guard const lock {m_mutex}; }
+
+    m_notification.notify_all();
+}
@@ -0,0 +1,54 @@
+#include <utility>
+
+#include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+#include "Core/ExecutiveSystem/CPU/Queues/CPUSpawnBatch.hpp"
+
+USING_RUKEN_NAMESPACE
+
+CPUSpawnBatch::CPUSpawnBatch(RkSize const in_reservation) noexcept:
+    m_reservation {in_reservation},
+    m_previous    {std::exchange(WorkerInfo::spawn_batch, this)}
+{}
+
+CPUSpawnBatch::~CPUSpawnBatch() noexcept
+{
+    WorkerInfo::spawn_batch = m_previous;
+
+    Submit();
+}
+
+RkVoid CPUSpawnBatch::Defer(CentralProcessingQueue& in_queue, std::coroutine_handle<> const in_handle) noexcept
+{
+    // Fan-outs usually target a single queue, looking for the last used group first
+    for (auto group = m_groups.rbegin(); group != m_groups.rend(); ++group)
+    {
+        if (group->queue == std::addressof(in_queue))
+        {
+            group->handles.emplace_back(in_handle);
+            return;
+        }
+    }
+
+    Group& group {m_groups.emplace_back(Group {.queue = std::addressof(in_queue)})};
+
+    group.handles.reserve(m_reservation);
+    group.handles.emplace_back(in_handle);
+}
+
+RkVoid CPUSpawnBatch::Submit() noexcept
+{
+    for (Group& group: m_groups)
+        group.queue->PushBulk(group.handles);
+
+    m_groups.clear();
+}
+
+RkSize CPUSpawnBatch::GetSize() const noexcept
+{
+    RkSize size {0ULL};
+
+    for (Group const& group: m_groups)
+        size += group.handles.size();
+
+    return size;
+}
@@ -0,0 +1,53 @@
+#include "Core/ExecutiveSystem/CPU/Cancellation/CancellationSource.hpp"
+
+USING_RUKEN_NAMESPACE
+
+CancellationSource::CancellationSource() noexcept:
+    m_state {nullptr}
+{}
+
+CancellationSource::CancellationSource(CancellationToken const& in_parent) noexcept:
+    m_state {in_parent.CanBeCancelled() ? new internal::CancellationState(*in_parent.GetState()) : nullptr}
+{}
+
+CancellationSource::~CancellationSource() noexcept
+{
+    // The source owns the initial reference of the state
+    if (internal::CancellationState* const state {m_state.load(std::memory_order_acquire)})
+        state->DecrementReferenceCount();
+}
+
+internal::CancellationState& CancellationSource::GetState() const noexcept
+{
+    if (internal::CancellationState* const state {m_state.load(std::memory_order_acquire)})
+        return *state;
+
+    internal::CancellationState* expected {nullptr};
+    internal::CancellationState* const state {new internal::CancellationState()};
+
+    // Another thread allocated the state first, ours has never been published
+    if (!m_state.compare_exchange_strong(expected, state, std::memory_order_acq_rel))
+    {
+        delete state;
+        return *expected;
+    }
+
+    return *state;
+}
+
+RkVoid CancellationSource::RequestCancellation() const noexcept
+{
+    GetState().Request();
+}
+
+RkBool CancellationSource::IsCancellationRequested() const noexcept
+{
+    internal::CancellationState const* const state {m_state.load(std::memory_order_acquire)};
+
+    return state && state->IsRequested();
+}
+
+CancellationToken CancellationSource::GetToken() const noexcept
+{
+    return CancellationToken(GetState());
+}
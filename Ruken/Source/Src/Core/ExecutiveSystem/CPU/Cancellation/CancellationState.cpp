@@ -0,0 +1,53 @@
+#include "Core/ExecutiveSystem/CPU/Cancellation/CancellationState.hpp"
+
+USING_RUKEN_NAMESPACE
+
+internal::CancellationState::CancellationState(CancellationState& in_parent) noexcept:
+    m_link_release {2U},
+    m_parent       {in_parent}
+{
+    m_parent_link.Setup(*this, m_parent);
+
+    // If the parent has already been cancelled, there is nothing to link to
+    if (!m_parent_link.TryAttach())
+    {
+        m_link_release.store(1U, std::memory_order_release);
+        Request();
+    }
+}
+
+RkVoid internal::CancellationState::Release() noexcept
+{
+    if (m_link_release.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+        delete this;
+}
+
+RkVoid internal::CancellationState::Deallocate()
+{
+    // If the detach succeeded, the parent will never notify this state and it can be deleted right away.
+    // Otherwise the parent is already notifying it, and the last of the two parties will delete the state.
+    if (m_link_release.load(std::memory_order_acquire) == 2U && m_parent_link.Detach())
+    {
+        delete this;
+        return;
+    }
+
+    Release();
+}
+
+RkVoid internal::CancellationState::Request() noexcept
+{
+    if (!m_requested.exchange(true, std::memory_order_acq_rel))
+        SignalConsume();
+}
+
+RkBool internal::CancellationState::IsRequested() const noexcept
+{
+    return m_requested.load(std::memory_order_acquire);
+}
+
+RkVoid internal::CancellationState::OnAwaitedContinuation() noexcept
+{
+    Request();
+    Release();
+}
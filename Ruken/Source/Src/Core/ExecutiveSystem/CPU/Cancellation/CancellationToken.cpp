@@ -0,0 +1,27 @@
+#include "Core/ExecutiveSystem/CPU/Cancellation/CancellationToken.hpp"
+
+USING_RUKEN_NAMESPACE
+
+CancellationToken::CancellationToken() noexcept:
+    CPUAwaitableHandle<RkVoid, true> {nullptr}
+{}
+
+CancellationToken::CancellationToken(internal::CancellationState& in_state) noexcept:
+    CPUAwaitableHandle<RkVoid, true> {in_state},
+    m_state                          {std::addressof(in_state)}
+{}
+
+RkBool CancellationToken::IsCancellationRequested() const noexcept
+{
+    return m_state && m_state->IsRequested();
+}
+
+RkBool CancellationToken::CanBeCancelled() const noexcept
+{
+    return m_state != nullptr;
+}
+
+internal::CancellationState* CancellationToken::GetState() const noexcept
+{
+    return m_state;
+}
@@ -1,47 +1,208 @@
+#include <utility>
+#include <algorithm>
+
+#include "Build/Config.hpp"
+#include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+#include "Core/ExecutiveSystem/CPU/CPUParkingLot.hpp"
+#include "Core/ExecutiveSystem/CPU/Metrics/WorkerMetrics.hpp"
 #include "Core/ExecutiveSystem/CPU/Queues/CentralProcessingQueue.hpp"
+#include "Core/ExecutiveSystem/CPU/Tracing/TaskTracer.hpp"
+#include "Core/ExecutiveSystem/CPU/Timers/CPUTimerWheel.hpp"
 
 USING_RUKEN_NAMESPACE
 
-CentralProcessingQueue::CentralProcessingQueue(const RkSize in_size) noexcept:
-	m_queue {static_cast<unsigned>(in_size)}
+CentralProcessingQueue::CentralProcessingQueue(const RkSize in_size, RkUint8 const in_priority) noexcept:
+	m_queue       {static_cast<unsigned>(in_size)},
+    m_last_served {Clock::now().time_since_epoch().count()},
+    m_priority    {in_priority}
 {}
 
-RkVoid CentralProcessingQueue::TryConsumeJob(RkUint32 const in_max_attempts) noexcept
+CentralProcessingQueue::~CentralProcessingQueue() noexcept
+{
+    OverflowNode* node {m_overflow.exchange(nullptr, std::memory_order_acquire)};
+
+    while (node)
+        delete std::exchange(node, node->next);
+}
+
+RkVoid CentralProcessingQueue::LinkOverflow(OverflowNode* in_first, OverflowNode* in_last) noexcept
+{
+    in_last->next = m_overflow.load(std::memory_order_relaxed);
+
+    while (!m_overflow.compare_exchange_weak(in_last->next, in_first, std::memory_order_release, std::memory_order_relaxed))
+        atomic_queue::spin_loop_pause();
+}
+
+RkVoid CentralProcessingQueue::DrainOverflow() noexcept
+{
+    // Taking ownership of the whole list at once, this avoids any ABA issue
+    OverflowNode* node     {m_overflow.exchange(nullptr, std::memory_order_acquire)};
+    OverflowNode* reversed {nullptr};
+
+    // The list is stored last in first out, reversing it to drain the oldest jobs first
+    while (node)
+    {
+        OverflowNode* next {node->next};
+
+        node->next = reversed;
+        reversed   = node;
+        node       = next;
+    }
+
+    while (reversed)
+    {
+        std::coroutine_handle<> handle {reversed->handle};
+
+        // The queue is full again, giving the remaining nodes back to the list
+        if (!m_queue.try_push(std::move(handle)))
+        {
+            OverflowNode* last {reversed};
+            while (last->next)
+                last = last->next;
+
+            LinkOverflow(reversed, last);
+            return;
+        }
+
+        delete std::exchange(reversed, reversed->next);
+    }
+}
+
+RkBool CentralProcessingQueue::TryConsumeJob(RkUint32 const in_max_attempts) noexcept
 {
     std::coroutine_handle<>      job;
     ConcurrencyCounter constexpr one_optimal { {.current_concurrency = 0, .optimal_concurrency = 1} };
     RkSize                       remaining_attempts { static_cast<RkSize>(in_max_attempts) + 1ULL   };
 
+    // Giving priority to overflowed jobs, otherwise they could starve under a sustained load
+    if (m_overflow.load(std::memory_order_relaxed) != nullptr)
+        DrainOverflow();
+
     // Attempting to pop a job
     while (--remaining_attempts > 0 && !m_queue.try_pop(job))
         atomic_queue::spin_loop_pause();
 
     // Escaping timeouts
     if (remaining_attempts == 0)
-        return;
+        return false;
 
     // Otherwise we need to update the concurrency and run the job
     m_concurrency.fetch_sub(one_optimal.value, std::memory_order_acq_rel);
+
+    // Every dequeued job starts a new chain of symmetric transfers
+    WorkerInfo::transfer_depth = 0ULL;
+
+    if (Clock::rep const deadline {m_deadline.load(std::memory_order_relaxed)}; deadline != 0 && Clock::now().time_since_epoch().count() > deadline)
+        m_missed_count.fetch_add(1ULL, std::memory_order_relaxed);
+
+    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Resume, job.address(), this);
     job.resume();
+    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::Suspend, job.address(), this);
+
+    return true;
 }
 
-RkFloat CentralProcessingQueue::GetSignedConcurrencyRequest(ConcurrencyCounter const& in_concurrency, RkUint32 const in_offset) const noexcept
+RkVoid CentralProcessingQueue::UpdateDepthHighWater(ConcurrencyCounter const& in_counter) noexcept
+{
+    // Each pending job requests one more worker, the optimal concurrency is the depth of the queue
+    RkSize const depth      {in_counter.optimal_concurrency};
+    RkSize       high_water {m_depth_high_water.load(std::memory_order_relaxed)};
+
+    // Only contended while the queue is growing past its previous record
+    while (depth > high_water && !m_depth_high_water.compare_exchange_weak(high_water, depth, std::memory_order_relaxed))
+        atomic_queue::spin_loop_pause();
+}
+
+RkVoid CentralProcessingQueue::AccountPushedJobs(RkSize const in_count) noexcept
+{
+    ConcurrencyCounter constexpr one_optimal { {.current_concurrency = 0, .optimal_concurrency = 1} };
+
+    // A single update is enough to request as many workers as there are new jobs
+    RkUint64           const increment {one_optimal.value * in_count};
+    ConcurrencyCounter const counter   { .value = m_concurrency.fetch_add(increment, std::memory_order_acq_rel) + increment };
+
+    UpdateDepthHighWater(counter);
+
+    // Idle workers are parked until some job shows up
+    CPUParkingLot::GetInstance().Notify();
+}
+
+RkFloat CentralProcessingQueue::GetSignedConcurrencyRequest(ConcurrencyCounter const& in_concurrency, RkInt32 const in_offset) const noexcept
 {
     return ComputeOptimalConcurrency(in_concurrency.optimal_concurrency)
               - static_cast<RkFloat>(in_concurrency.current_concurrency)
               + static_cast<RkFloat>(in_offset);
 }
 
-RkVoid CentralProcessingQueue::Push(std::coroutine_handle<> in_handle) noexcept
+RkVoid CentralProcessingQueue::Push(std::coroutine_handle<> in_handle)
 {
-    ConcurrencyCounter constexpr one_optimal { {.current_concurrency = 0, .optimal_concurrency = 1} };
+    // Pushing is never allowed to block, the caller might be a worker that this queue is waiting on
+    if (!m_queue.try_push(std::move(in_handle)))
+    {
+        OverflowNode* node {new OverflowNode {.handle = in_handle, .next = nullptr}};
 
-    m_queue      .push     (std::forward<std::coroutine_handle<>>(in_handle));
-    m_concurrency.fetch_add(one_optimal.value, std::memory_order_acq_rel);
+        LinkOverflow(node, node);
+        m_overflow_count.fetch_add(1ULL, std::memory_order_relaxed);
+    }
+
+    AccountPushedJobs(1ULL);
 }
 
-RkVoid CentralProcessingQueue::PopAndRun(RkBool const in_sticky, std::stop_token const& in_stop_token) noexcept
+RkVoid CentralProcessingQueue::PushBulk(std::span<std::coroutine_handle<> const> const in_handles)
 {
+    if (in_handles.empty())
+        return;
+
+    RkSize pushed {0ULL};
+    for (; pushed < in_handles.size(); ++pushed)
+    {
+        std::coroutine_handle<> handle {in_handles[pushed]};
+        if (!m_queue.try_push(std::move(handle)))
+            break;
+    }
+
+    // The remaining jobs are chained newest first, like the overflow list itself, and linked with a single exchange
+    RkSize const overflowed {in_handles.size() - pushed};
+    if (overflowed > 0ULL)
+    {
+        OverflowNode* first {nullptr};
+        OverflowNode* last  {nullptr};
+
+        try
+        {
+            for (RkSize index = pushed; index < in_handles.size(); ++index)
+            {
+                first = new OverflowNode {.handle = in_handles[index], .next = first};
+
+                if (last == nullptr)
+                    last = first;
+            }
+        }
+        catch (...)
+        {
+            // The jobs already in the ring buffer will be run, they still have to be accounted for
+            while (first)
+                delete std::exchange(first, first->next);
+
+            AccountPushedJobs(pushed);
+            throw;
+        }
+
+        LinkOverflow(first, last);
+        m_overflow_count.fetch_add(overflowed, std::memory_order_relaxed);
+    }
+
+    AccountPushedJobs(in_handles.size());
+}
+
+RkSize CentralProcessingQueue::PopAndRun(RkBool            const  in_sticky,
+                                         std::stop_token   const& in_stop_token,
+                                         RkSize            const  in_max_rounds,
+                                         Clock::time_point const  in_deadline) noexcept
+{
+    // Reading the clock is only worth it for time budgeted callers
+    RkBool const budgeted {in_deadline != Clock::time_point::max()};
+
     RkFloat                      signed_request;
     ConcurrencyCounter           counter     { .value = m_concurrency.load(std::memory_order_acquire) };
     ConcurrencyCounter constexpr one_current { {.current_concurrency = 1, .optimal_concurrency = 0} };
@@ -50,29 +211,79 @@ RkVoid CentralProcessingQueue::PopAndRun(RkBool const in_sticky, std::stop_token
     {
         // Checking if the calling worker is needed to meet the requirements of the queue.
         if ((signed_request = GetSignedConcurrencyRequest(counter, 1)) < 0.0F)
-            return;
+            return 0ULL;
 
         // If the caller is needed then we need to update the concurrency of the queue
     } while(!m_concurrency.compare_exchange_weak(counter.value, counter.value + one_current.value, std::memory_order_acq_rel));
 
+    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::PopAndRunBegin, nullptr, this);
+
+    RkSize rounds               {0ULL};
+    RkSize executed             {0ULL};
+    RkSize empty_polls          {0ULL};
+    RkSize continuation_resumes {0ULL};
+
+    // Metrics are accumulated locally and published once, the cost does not depend on the number of jobs
+    auto const consume_job = [&] {
+        if (TryConsumeJob(50))
+        {
+            ++executed;
+            continuation_resumes += WorkerInfo::transfer_depth;
+        }
+        else
+            ++empty_polls;
+    };
+
     // If the caller don't want to stick to the queue
     // then we only try to consume a single job before returning
     if (!in_sticky)
-        TryConsumeJob(50);
+    {
+        m_last_served.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        consume_job();
+    }
 
     else do
     {
+        // Being served pushes the implicit deadline of the queue back, letting the other queues catch up
+        m_last_served.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+
         // Otherwise, we'll consume a maximum of 10 jobs
         for(int i = 0; i < 10; ++i)
-            TryConsumeJob(50);
+        {
+            if (budgeted && Clock::now() >= in_deadline)
+                break;
+
+            consume_job();
+        }
+
+        // Sticky workers might stay on this queue for a long time, timers must not starve meanwhile
+        CPUTimerWheel::GetInstance().Process();
 
         // Checking if the queue still needs us
         counter.value  = m_concurrency.load(std::memory_order_acquire);
         signed_request = GetSignedConcurrencyRequest(counter, -1);
-    } while (signed_request >= 1.0F && !in_stop_token.stop_requested());
+    } while (signed_request >= 1.0F && ++rounds < in_max_rounds && !in_stop_token.stop_requested()
+             && (!budgeted || Clock::now() < in_deadline));
+
+    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::PopAndRunEnd, nullptr, this);
 
     // Finally decrementing the current concurrency of the queue
     m_concurrency.fetch_sub(one_current.value, std::memory_order_acq_rel);
+
+    if (executed > 0ULL)
+        m_executed_count.fetch_add(executed, std::memory_order_relaxed);
+
+    if (empty_polls > 0ULL)
+        m_empty_poll_count.fetch_add(empty_polls, std::memory_order_relaxed);
+
+    if (WorkerMetrics* const metrics {WorkerInfo::metrics})
+    {
+        metrics->executed_jobs       .fetch_add(executed,             std::memory_order_relaxed);
+        metrics->empty_polls         .fetch_add(empty_polls,          std::memory_order_relaxed);
+        metrics->continuation_resumes.fetch_add(continuation_resumes, std::memory_order_relaxed);
+    }
+
+    return executed;
 }
 
 ConcurrencyCounter CentralProcessingQueue::GetConcurrencyCounter() const noexcept
@@ -81,6 +292,72 @@ ConcurrencyCounter CentralProcessingQueue::GetConcurrencyCounter() const noexcep
     return counter;
 }
 
+RkSize CentralProcessingQueue::GetOverflowCount() const noexcept
+{
+    return m_overflow_count.load(std::memory_order_relaxed);
+}
+
+RkVoid CentralProcessingQueue::SetPriority(RkUint8 const in_priority) noexcept
+{
+    m_priority.store(in_priority, std::memory_order_relaxed);
+}
+
+RkUint8 CentralProcessingQueue::GetPriority() const noexcept
+{
+    return m_priority.load(std::memory_order_relaxed);
+}
+
+RkVoid CentralProcessingQueue::SetDeadline(Clock::time_point const in_deadline) noexcept
+{
+    // 0 is reserved for queues without deadline, the epoch of the clock is never used in practice
+    m_deadline.store(std::max<Clock::rep>(in_deadline.time_since_epoch().count(), 1), std::memory_order_relaxed);
+}
+
+RkVoid CentralProcessingQueue::ClearDeadline() noexcept
+{
+    m_deadline.store(0, std::memory_order_relaxed);
+}
+
+CentralProcessingQueue::Clock::time_point CentralProcessingQueue::GetEffectiveDeadline() const noexcept
+{
+    if (Clock::rep const deadline {m_deadline.load(std::memory_order_relaxed)}; deadline != 0)
+        return Clock::time_point {Clock::duration {deadline}};
+
+    std::chrono::microseconds const delay {RUKEN_CPU_QUEUE_PRIORITY_STEP_US * (256LL - m_priority.load(std::memory_order_relaxed))};
+
+    return Clock::time_point {Clock::duration {m_last_served.load(std::memory_order_relaxed)}} + delay;
+}
+
+RkSize CentralProcessingQueue::GetMissedDeadlineCount() const noexcept
+{
+    return m_missed_count.load(std::memory_order_relaxed);
+}
+
+RkUint64 CentralProcessingQueue::GetExecutedJobCount() const noexcept
+{
+    return m_executed_count.load(std::memory_order_relaxed);
+}
+
+RkUint64 CentralProcessingQueue::GetEmptyPollCount() const noexcept
+{
+    return m_empty_poll_count.load(std::memory_order_relaxed);
+}
+
+RkSize CentralProcessingQueue::GetDepth() const noexcept
+{
+    return GetConcurrencyCounter().optimal_concurrency;
+}
+
+RkSize CentralProcessingQueue::GetDepthHighWaterMark() const noexcept
+{
+    return m_depth_high_water.load(std::memory_order_relaxed);
+}
+
+RkSize CentralProcessingQueue::GetCapacity() const noexcept
+{
+    return static_cast<RkSize>(m_queue.capacity());
+}
+
 RkFloat CentralProcessingQueue::ComputeOptimalConcurrency(RkUint32 const in_max_concurrency) const noexcept
 {
     // For now the optimal concurrency is just the max concurrency
@@ -1,16 +1,21 @@
+#include <utility>
+
 #include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
 #include "Core/ExecutiveSystem/CPU/CentralProcessingUnit.hpp"
 #include "Core/ExecutiveSystem/CPU/Queues/CentralProcessingQueue.hpp"
 
 USING_RUKEN_NAMESPACE
 
-CentralProcessingUnit::CentralProcessingUnit() noexcept
-{
-    RkSize const concurrency {std::thread::hardware_concurrency() - 1};
+CentralProcessingUnit::CentralProcessingUnit() noexcept:
+    CentralProcessingUnit {std::thread::hardware_concurrency() - 1ULL}
+{}
 
-    m_workers.reserve(concurrency);
+CentralProcessingUnit::CentralProcessingUnit(RkSize const in_workers_count, std::vector<CentralProcessingQueue*> in_queues) noexcept:
+    m_queues {std::move(in_queues)}
+{
+    m_workers.reserve(in_workers_count);
 
-	for (RkSize index = 0ULL; index < concurrency; ++index)
+	for (RkSize index = 0ULL; index < in_workers_count; ++index)
         m_workers.emplace_back(std::make_unique<Worker>("CPU " + std::to_string(index), m_queues));
 
 	WorkerInfo::name = std::string("CPU Main");
@@ -23,6 +28,67 @@ RkVoid CentralProcessingUnit::RegisterQueue(CentralProcessingQueue& in_queue) no
 
 RkVoid CentralProcessingUnit::CallerAsWorker(std::stop_token const& in_should_return) const noexcept
 {
+    WorkerMetrics* const previous_metrics {std::exchange(WorkerInfo::metrics, &m_caller_metrics)};
+
+    RkSize idle_cycles {0ULL};
+
     while (!in_should_return.stop_requested())
-        Worker::ProcessQueues(m_queues, in_should_return);
+    {
+        if (Worker::ProcessQueues(m_queues, in_should_return) > 0ULL)
+            idle_cycles = 0ULL;
+        else
+            Worker::Idle(m_queues, in_should_return, idle_cycles);
+    }
+
+    WorkerInfo::metrics = previous_metrics;
+}
+
+RkVoid CentralProcessingUnit::CallerAsWorker(std::chrono::steady_clock::time_point const in_deadline) const noexcept
+{
+    std::stop_token const never_stops      {};
+    WorkerMetrics*  const previous_metrics {std::exchange(WorkerInfo::metrics, &m_caller_metrics)};
+
+    RkSize idle_cycles {0ULL};
+
+    while (std::chrono::steady_clock::now() < in_deadline)
+    {
+        if (Worker::ProcessQueues(m_queues, never_stops, in_deadline) > 0ULL)
+            idle_cycles = 0ULL;
+        else
+            Worker::Idle(m_queues, never_stops, idle_cycles, nullptr, in_deadline);
+    }
+
+    WorkerInfo::metrics = previous_metrics;
+}
+
+CPUMetricsSnapshot CentralProcessingUnit::GetMetricsSnapshot() const noexcept
+{
+    CPUMetricsSnapshot snapshot {.time_point = std::chrono::steady_clock::now()};
+
+    snapshot.workers.reserve(m_workers.size());
+    for (std::unique_ptr<Worker> const& worker: m_workers)
+        snapshot.workers.emplace_back(worker->GetMetrics().TakeSnapshot());
+
+    snapshot.callers = m_caller_metrics.TakeSnapshot();
+
+    snapshot.queues.reserve(m_queues.size());
+    for (CentralProcessingQueue const* queue: m_queues)
+    {
+        snapshot.queues.emplace_back(QueueMetricsSnapshot {
+            .queue                 = queue,
+            .executed_jobs         = queue->GetExecutedJobCount(),
+            .empty_polls           = queue->GetEmptyPollCount(),
+            .depth                 = queue->GetDepth(),
+            .depth_high_water_mark = queue->GetDepthHighWaterMark(),
+            .overflow_count        = queue->GetOverflowCount(),
+            .missed_deadline_count = queue->GetMissedDeadlineCount()
+        });
+    }
+
+    return snapshot;
+}
+
+std::vector<std::unique_ptr<Worker>> const& CentralProcessingUnit::GetWorkers() const noexcept
+{
+    return m_workers;
 }
@@ -0,0 +1,375 @@
+#pragma once
+
+#pragma region SendAwaiter
+
+template <typename TType>
+Channel<TType>::SendAwaiter::SendAwaiter(Channel& in_channel, TType&& in_value):
+    m_channel {in_channel},
+    m_value   {std::move(in_value)}
+{}
+
+template <typename TType>
+template <typename TPromise>
+RkBool Channel<TType>::SendAwaiter::await_suspend(std::coroutine_handle<TPromise> in_handle)
+{
+    static_assert(std::is_base_of_v<CPUAwaiter, TPromise>, "Only CPU tasks can await a channel");
+
+    return m_channel.SuspendSend(*this, static_cast<CPUAwaiter&>(in_handle.promise()));
+}
+
+#pragma endregion
+
+#pragma region ReceiveAwaiter
+
+template <typename TType>
+Channel<TType>::ReceiveAwaiter::ReceiveAwaiter(Channel& in_channel) noexcept:
+    m_channel {in_channel}
+{}
+
+// Nothing has been received before the awaiter is awaited, this also keeps move only values supported
+template <typename TType>
+Channel<TType>::ReceiveAwaiter::ReceiveAwaiter(ReceiveAwaiter const& in_copy) noexcept:
+    m_channel {in_copy.m_channel}
+{}
+
+template <typename TType>
+template <typename TPromise>
+RkBool Channel<TType>::ReceiveAwaiter::await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept
+{
+    static_assert(std::is_base_of_v<CPUAwaiter, TPromise>, "Only CPU tasks can await a channel");
+
+    return m_channel.SuspendReceive(*this, static_cast<CPUAwaiter&>(in_handle.promise()));
+}
+
+#pragma endregion
+
+#pragma region ReceiveBatchAwaiter
+
+template <typename TType>
+Channel<TType>::ReceiveBatchAwaiter::ReceiveBatchAwaiter(Channel& in_channel, RkSize const in_max_count) noexcept:
+    ReceiveAwaiter {in_channel},
+    m_max_count    {in_max_count}
+{}
+
+template <typename TType>
+Channel<TType>::ReceiveBatchAwaiter::ReceiveBatchAwaiter(ReceiveBatchAwaiter const& in_copy) noexcept:
+    ReceiveAwaiter {in_copy},
+    m_max_count    {in_copy.m_max_count}
+{}
+
+template <typename TType>
+template <typename TPromise>
+RkBool Channel<TType>::ReceiveBatchAwaiter::await_suspend(std::coroutine_handle<TPromise> in_handle) noexcept
+{
+    static_assert(std::is_base_of_v<CPUAwaiter, TPromise>, "Only CPU tasks can await a channel");
+
+    if (this->m_channel.ReceiveAvailable(m_max_count, m_values))
+        return false;
+
+    // Nothing is available, waiting for a single value like any other receiver
+    return this->m_channel.SuspendReceive(*this, static_cast<CPUAwaiter&>(in_handle.promise()));
+}
+
+template <typename TType>
+std::vector<TType> Channel<TType>::ReceiveBatchAwaiter::await_resume() noexcept
+{
+    if (this->m_value)
+        m_values.emplace_back(std::move(*this->m_value));
+
+    return std::move(m_values);
+}
+
+#pragma endregion
+
+#pragma region Lifetime
+
+template <typename TType>
+Channel<TType>::Channel(RkSize const in_capacity) noexcept:
+    m_capacity {in_capacity}
+{}
+
+#pragma endregion
+
+#pragma region Methods
+
+template <typename TType>
+RkVoid Channel<TType>::LockState() noexcept
+{
+    while (m_guard.test_and_set(std::memory_order_acquire))
+        atomic_queue::spin_loop_pause();
+}
+
+template <typename TType>
+RkVoid Channel<TType>::UnlockState() noexcept
+{
+    m_guard.clear(std::memory_order_release);
+}
+
+template <typename TType>
+RkBool Channel<TType>::TrySendUnsafe(TType& inout_value, CPUContinuationQueue& inout_resumed)
+{
+    if (m_closed)
+        return false;
+
+    // Receivers are only waiting if the buffer is empty, the value can be handed over directly
+    if (!m_receivers.Empty())
+    {
+        ReceiveAwaiter& receiver {static_cast<ReceiveAwaiter&>(*m_receivers.Pop())};
+
+        try
+        {
+            receiver.m_value.emplace(std::move(inout_value));
+        }
+        catch (...)
+        {
+            // The receiver keeps waiting for another value
+            m_receivers.Push(receiver);
+            throw;
+        }
+
+        inout_resumed.Push(receiver);
+
+        return true;
+    }
+
+    if (m_buffer.size() >= m_capacity)
+        return false;
+
+    m_buffer.emplace_back(std::move(inout_value));
+
+    return true;
+}
+
+template <typename TType>
+RkBool Channel<TType>::TryReceiveUnsafe(std::optional<TType>& out_value, CPUContinuationQueue& inout_resumed) noexcept
+{
+    if (!m_buffer.empty())
+    {
+        out_value.emplace(std::move(m_buffer.front()));
+        m_buffer.pop_front();
+
+        // A slot has been freed, the oldest suspended sender can now fill it
+        if (!m_senders.Empty())
+        {
+            SendAwaiter& sender {static_cast<SendAwaiter&>(*m_senders.Pop())};
+
+            m_buffer.emplace_back(std::move(sender.m_value));
+            sender.m_sent = true;
+            inout_resumed.Push(sender);
+        }
+
+        return true;
+    }
+
+    // Unbuffered channels, the value is directly taken from the oldest suspended sender
+    if (!m_senders.Empty())
+    {
+        SendAwaiter& sender {static_cast<SendAwaiter&>(*m_senders.Pop())};
+
+        out_value.emplace(std::move(sender.m_value));
+        sender.m_sent = true;
+        inout_resumed.Push(sender);
+
+        return true;
+    }
+
+    return false;
+}
+
+template <typename TType>
+RkBool Channel<TType>::ReceiveAvailable(RkSize const in_max_count, std::vector<TType>& out_values) noexcept
+{
+    CPUContinuationQueue resumed {};
+    std::optional<TType> value   {};
+
+    LockState();
+
+    while (out_values.size() < in_max_count && TryReceiveUnsafe(value, resumed))
+        out_values.emplace_back(std::move(*value));
+
+    RkBool const received {!out_values.empty() || m_closed};
+
+    UnlockState();
+    Resume(resumed);
+
+    return received;
+}
+
+template <typename TType>
+RkBool Channel<TType>::SuspendSend(SendAwaiter& inout_awaiter, CPUAwaiter& inout_owner)
+{
+    CPUContinuationQueue resumed {};
+
+    LockState();
+
+    RkBool sent;
+
+    try
+    {
+        sent = TrySendUnsafe(inout_awaiter.m_value, resumed);
+    }
+    catch (...)
+    {
+        // The task has not been suspended, the exception is rethrown at its suspension point
+        UnlockState();
+        throw;
+    }
+
+    if (sent || m_closed)
+    {
+        inout_awaiter.m_sent = !m_closed;
+
+        UnlockState();
+        Resume(resumed);
+
+        return false;
+    }
+
+    inout_awaiter.owner = std::addressof(inout_owner);
+    m_senders.Push(inout_awaiter);
+
+    // The task might be resumed by another worker as soon as the guard is released,
+    // the awaiter must not be accessed past this point.
+    UnlockState();
+
+    return true;
+}
+
+template <typename TType>
+RkBool Channel<TType>::SuspendReceive(ReceiveAwaiter& inout_awaiter, CPUAwaiter& inout_owner) noexcept
+{
+    CPUContinuationQueue resumed {};
+
+    LockState();
+
+    if (TryReceiveUnsafe(inout_awaiter.m_value, resumed) || m_closed)
+    {
+        UnlockState();
+        Resume(resumed);
+
+        return false;
+    }
+
+    inout_awaiter.owner = std::addressof(inout_owner);
+    m_receivers.Push(inout_awaiter);
+
+    // The task might be resumed by another worker as soon as the guard is released,
+    // the awaiter must not be accessed past this point.
+    UnlockState();
+
+    return true;
+}
+
+template <typename TType>
+RkVoid Channel<TType>::Resume(CPUContinuationQueue& inout_resumed) noexcept
+{
+    // Resumed tasks might complete and destroy their awaiter as soon as they are notified
+    while (CPUContinuation* const continuation {inout_resumed.Pop()})
+        continuation->owner->OnAwaitedContinuation();
+}
+
+template <typename TType>
+typename Channel<TType>::SendAwaiter Channel<TType>::Send(TType in_value)
+{
+    return SendAwaiter {*this, std::move(in_value)};
+}
+
+template <typename TType>
+RkBool Channel<TType>::TrySend(TType in_value)
+{
+    CPUContinuationQueue resumed {};
+
+    LockState();
+
+    RkBool sent;
+
+    try
+    {
+        sent = TrySendUnsafe(in_value, resumed);
+    }
+    catch (...)
+    {
+        UnlockState();
+        throw;
+    }
+
+    UnlockState();
+
+    Resume(resumed);
+
+    return sent;
+}
+
+template <typename TType>
+typename Channel<TType>::ReceiveAwaiter Channel<TType>::Receive() noexcept
+{
+    return ReceiveAwaiter {*this};
+}
+
+template <typename TType>
+typename Channel<TType>::ReceiveBatchAwaiter Channel<TType>::ReceiveBatch(RkSize const in_max_count) noexcept
+{
+    return ReceiveBatchAwaiter {*this, in_max_count};
+}
+
+template <typename TType>
+std::optional<TType> Channel<TType>::TryReceive() noexcept
+{
+    CPUContinuationQueue resumed {};
+    std::optional<TType> value   {};
+
+    LockState();
+    TryReceiveUnsafe(value, resumed);
+    UnlockState();
+
+    Resume(resumed);
+
+    return value;
+}
+
+template <typename TType>
+RkVoid Channel<TType>::Close() noexcept
+{
+    CPUContinuationQueue resumed {};
+
+    LockState();
+
+    m_closed = true;
+
+    // Suspended senders fail, suspended receivers are notified of the closure.
+    // Receivers are only suspended if the buffer is empty, so they have nothing left to drain.
+    while (CPUContinuation* const sender   {m_senders  .Pop()}) resumed.Push(*sender);
+    while (CPUContinuation* const receiver {m_receivers.Pop()}) resumed.Push(*receiver);
+
+    UnlockState();
+
+    Resume(resumed);
+}
+
+template <typename TType>
+RkBool Channel<TType>::IsClosed() noexcept
+{
+    LockState();
+    RkBool const closed {m_closed};
+    UnlockState();
+
+    return closed;
+}
+
+template <typename TType>
+RkSize Channel<TType>::GetSize() noexcept
+{
+    LockState();
+    RkSize const size {m_buffer.size()};
+    UnlockState();
+
+    return size;
+}
+
+template <typename TType>
+RkSize Channel<TType>::GetCapacity() const noexcept
+{
+    return m_capacity;
+}
+
+#pragma endregion
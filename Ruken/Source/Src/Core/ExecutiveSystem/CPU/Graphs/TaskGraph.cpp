@@ -0,0 +1,190 @@
+#include <algorithm>
+
+#include "Core/ExecutiveSystem/CPU/Graphs/TaskGraph.hpp"
+
+USING_RUKEN_NAMESPACE
+
+TaskGraph::~TaskGraph() noexcept
+{
+    for (internal::TaskGraphRoutine const& routine: m_routines)
+        routine.handle.destroy();
+}
+
+internal::TaskGraphRoutine TaskGraph::Routine(NodeId const in_node)
+{
+    /**
+     * \brief Notifies the graph once the node is suspended, so that it can be pushed again
+     *        by the next launch without ever being resumed while still running.
+     */
+    struct CompletionAwaiter: std::suspend_always
+    {
+        TaskGraph& graph;
+        NodeId     node;
+
+        RkVoid await_suspend(std::coroutine_handle<>) const noexcept
+        { graph.OnNodeCompleted(node); }
+    };
+
+    while (true)
+    {
+        try
+        {
+            m_nodes[in_node].work();
+        }
+        catch (...)
+        {
+            // Only the first exception is kept, the remaining nodes still have to be executed
+            if (!m_faulted.test_and_set(std::memory_order_acq_rel))
+                Cancel(std::current_exception());
+        }
+
+        co_await CompletionAwaiter {{}, *this, in_node};
+    }
+}
+
+RkVoid TaskGraph::OnNodeCompleted(NodeId const in_node) noexcept
+{
+    for (NodeId const successor: m_nodes[in_node].successors)
+    {
+        if (m_pending[successor].fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+            m_nodes[successor].queue->Push(m_routines[successor].handle);
+    }
+
+    // The graph might be destroyed or launched again as soon as it is signaled
+    if (m_remaining.fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+        SignalConsume();
+}
+
+TaskGraph::NodeId TaskGraph::AddNode(CentralProcessingQueue& in_queue, std::string in_name, std::function<RkVoid()> in_work)
+{
+    m_nodes.emplace_back(Node {
+        .name  = std::move(in_name),
+        .work  = std::move(in_work),
+        .queue = std::addressof(in_queue)
+    });
+
+    return m_nodes.size() - 1ULL;
+}
+
+RkVoid TaskGraph::AddDependency(NodeId const in_before, NodeId const in_after)
+{
+    m_nodes[in_before].successors.emplace_back(in_after);
+    m_nodes[in_after ].dependencies++;
+}
+
+RkBool TaskGraph::Compile()
+{
+    if (m_compiled)
+        return true;
+
+    // Kahn's algorithm, levels are the length of the longest path leading to each node
+    std::vector<RkSize> remaining (m_nodes.size());
+    std::vector<NodeId> order     {};
+
+    order.reserve(m_nodes.size());
+    m_roots.clear();
+
+    for (NodeId node = 0ULL; node < m_nodes.size(); ++node)
+    {
+        remaining[node]     = m_nodes[node].dependencies;
+        m_nodes[node].level = 0ULL;
+
+        if (remaining[node] == 0ULL)
+        {
+            m_roots.emplace_back(node);
+            order  .emplace_back(node);
+        }
+    }
+
+    m_levels = m_nodes.empty() ? 0ULL : 1ULL;
+
+    for (RkSize index = 0ULL; index < order.size(); ++index)
+    {
+        Node const& node {m_nodes[order[index]]};
+
+        for (NodeId const successor: node.successors)
+        {
+            m_nodes[successor].level = std::max<RkSize>(m_nodes[successor].level, node.level + 1ULL);
+            m_levels                 = std::max<RkSize>(m_levels, m_nodes[successor].level + 1ULL);
+
+            if (--remaining[successor] == 0ULL)
+                order.emplace_back(successor);
+        }
+    }
+
+    // Some nodes were never released, the graph contains a cycle
+    if (order.size() != m_nodes.size())
+        return false;
+
+    m_pending = std::make_unique<std::atomic<RkSize>[]>(m_nodes.size());
+
+    m_routines.reserve(m_nodes.size());
+    for (NodeId node = 0ULL; node < m_nodes.size(); ++node)
+        m_routines.emplace_back(Routine(node));
+
+    m_compiled = true;
+
+    return true;
+}
+
+TaskGraph& TaskGraph::Launch() noexcept
+{
+    Reset();
+    m_faulted.clear(std::memory_order_relaxed);
+
+    if (m_nodes.empty())
+    {
+        SignalConsume();
+        return *this;
+    }
+
+    for (NodeId node = 0ULL; node < m_nodes.size(); ++node)
+        m_pending[node].store(m_nodes[node].dependencies, std::memory_order_relaxed);
+
+    m_remaining.store(m_nodes.size(), std::memory_order_release);
+
+    for (NodeId const root: m_roots)
+        m_nodes[root].queue->Push(m_routines[root].handle);
+
+    return *this;
+}
+
+RkBool TaskGraph::IsCompiled() const noexcept
+{
+    return m_compiled;
+}
+
+std::vector<TaskGraph::Node> const& TaskGraph::GetNodes() const noexcept
+{
+    return m_nodes;
+}
+
+std::vector<TaskGraph::NodeId> const& TaskGraph::GetRoots() const noexcept
+{
+    return m_roots;
+}
+
+RkSize TaskGraph::GetLevelCount() const noexcept
+{
+    return m_levels;
+}
+
+RkVoid TaskGraph::DumpMermaid(std::ostream& inout_stream) const
+{
+    inout_stream << "flowchart LR;\n";
+
+    for (RkSize level = 0ULL; level < m_levels; ++level)
+    {
+        inout_stream << "    subgraph Level" << level << ";\n";
+
+        for (NodeId node = 0ULL; node < m_nodes.size(); ++node)
+            if (m_nodes[node].level == level)
+                inout_stream << "        N" << node << "[\"" << m_nodes[node].name << "\"];\n";
+
+        inout_stream << "    end;\n";
+    }
+
+    for (NodeId node = 0ULL; node < m_nodes.size(); ++node)
+        for (NodeId const successor: m_nodes[node].successors)
+            inout_stream << "    N" << node << "-->N" << successor << ";\n";
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+template <typename TPromise>
+RkVoid CPUIORequest::await_suspend(std::coroutine_handle<TPromise> in_handle)
+{
+    static_assert(std::is_base_of_v<CPUAwaiter, TPromise>, "Only CPU tasks can await I/O requests");
+
+    m_owner = &static_cast<CPUAwaiter&>(in_handle.promise());
+
+    // The task might be resumed by another worker as soon as the request is submitted,
+    // "this" must not be accessed past this point.
+    CPUIOService::GetInstance().Submit(*this);
+}
@@ -0,0 +1,128 @@
+#include <string>
+#include <algorithm>
+#include <functional>
+
+#include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+#include "Core/ExecutiveSystem/CPU/IO/CPUIOService.hpp"
+#include "Core/ExecutiveSystem/CPU/IO/CPUIORequest.hpp"
+
+USING_RUKEN_NAMESPACE
+
+CPUIOService::~CPUIOService() noexcept
+{
+    {
+        std::scoped_lock const lock {m_mutex};
+
+        // Stops are requested under the lock, this way threads about to retire know the list is not theirs to modify anymore
+        for (std::jthread& thread: m_threads)
+            thread.request_stop();
+    }
+
+    m_threads.clear();
+}
+
+CPUIOService& CPUIOService::GetInstance() noexcept
+{
+    static CPUIOService instance;
+
+    return instance;
+}
+
+RkVoid CPUIOService::StartThread()
+{
+    m_threads.emplace_back(std::bind_front(&CPUIOService::Routine, this), "Blocking " + std::to_string(m_started_count++));
+}
+
+RkVoid CPUIOService::Submit(CPUIORequest& in_request)
+{
+    {
+        std::scoped_lock const lock {m_mutex};
+
+        // Every thread is already busy, which most likely means blocked: another one is needed to make progress
+        if (m_pending_count + 1ULL > m_idle_count && m_threads.size() < max_thread_count)
+        {
+            try
+            {
+                StartThread();
+            }
+            catch (...)
+            {
+                // Busy threads will eventually get to the request, it is only rejected if there is none to execute it
+                if (m_threads.empty())
+                    throw;
+            }
+        }
+
+        in_request.m_next = nullptr;
+
+        if (m_tail)
+            m_tail->m_next = &in_request;
+        else
+            m_head = &in_request;
+
+        m_tail = &in_request;
+
+        ++m_pending_count;
+    }
+
+    m_notification.notify_one();
+}
+
+RkSize CPUIOService::GetThreadCount() noexcept
+{
+    std::scoped_lock const lock {m_mutex};
+
+    return m_threads.size();
+}
+
+RkVoid CPUIOService::Routine(std::stop_token const& in_stop_token, std::string const& in_name) noexcept
+{
+    WorkerInfo::name = in_name;
+
+    std::unique_lock lock {m_mutex};
+
+    while (true)
+    {
+        ++m_idle_count;
+        RkBool const has_request {m_notification.wait_for(lock, in_stop_token, idle_timeout, [this] { return m_head != nullptr; })};
+        --m_idle_count;
+
+        if (!has_request)
+        {
+            if (in_stop_token.stop_requested())
+                return;
+
+            if (m_threads.size() <= min_thread_count)
+                continue;
+
+            // Retiring, the thread is removed from the pool and only detached once the lock is released.
+            // The service might be destroyed right after that, nothing of it can be accessed anymore.
+            auto const   self   {std::ranges::find(m_threads, std::this_thread::get_id(), &std::jthread::get_id)};
+            std::jthread thread {std::move(*self)};
+
+            m_threads.erase(self);
+            lock.unlock();
+
+            thread.detach();
+
+            return;
+        }
+
+        CPUIORequest* const request {std::exchange(m_head, m_head->m_next)};
+
+        if (!m_head)
+            m_tail = nullptr;
+
+        --m_pending_count;
+
+        lock.unlock();
+
+        // The owner must be fetched before the notification since the request is destroyed once the task is resumed
+        CPUAwaiter* const owner {request->m_owner};
+
+        request->Execute();
+        owner  ->OnAwaitedContinuation();
+
+        lock.lock();
+    }
+}
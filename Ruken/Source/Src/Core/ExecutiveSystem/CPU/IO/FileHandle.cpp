@@ -0,0 +1,120 @@
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+#include "Utility/WindowsOS.hpp"
+#include "Core/ExecutiveSystem/CPU/IO/FileHandle.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+FileHandle::FileHandle(std::filesystem::path const& in_path, EFileAccess const in_access) noexcept
+{
+    HANDLE const handle {CreateFileW(
+        in_path.c_str(),
+        in_access == EFileAccess::Read ? GENERIC_READ    : GENERIC_WRITE,
+        FILE_SHARE_READ,
+        nullptr,
+        in_access == EFileAccess::Read ? OPEN_EXISTING : CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr)};
+
+    if (handle != INVALID_HANDLE_VALUE)
+        m_win_handle = handle;
+}
+
+FileHandle::FileHandle(FileHandle&& in_move) noexcept:
+    m_win_handle {std::exchange(in_move.m_win_handle, nullptr)}
+{}
+
+FileHandle::~FileHandle() noexcept
+{
+    if (m_win_handle)
+        CloseHandle(static_cast<HANDLE>(m_win_handle));
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkBool FileHandle::IsOpen() const noexcept
+{
+    return m_win_handle != nullptr;
+}
+
+RkSize FileHandle::GetSize() const noexcept
+{
+    LARGE_INTEGER size {};
+
+    if (!m_win_handle || !GetFileSizeEx(static_cast<HANDLE>(m_win_handle), &size))
+        return 0ULL;
+
+    return static_cast<RkSize>(size.QuadPart);
+}
+
+RkSize FileHandle::ReadAt(RkSize const in_offset, std::span<RkByte> const out_buffer) const noexcept
+{
+    RkSize total {0ULL};
+
+    while (m_win_handle && total < out_buffer.size())
+    {
+        // Win32 calls are limited to 32 bits sizes, the offset is passed through the overlapped structure
+        RkSize     const position {in_offset + total};
+        DWORD      const chunk    {static_cast<DWORD>(std::min<RkSize>(out_buffer.size() - total, std::numeric_limits<DWORD>::max()))};
+        DWORD            read     {0UL};
+        OVERLAPPED       overlapped {};
+
+        overlapped.Offset     = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32ULL);
+
+        if (!::ReadFile(static_cast<HANDLE>(m_win_handle), out_buffer.data() + total, chunk, &read, &overlapped) || read == 0UL)
+            break;
+
+        total += read;
+    }
+
+    return total;
+}
+
+RkSize FileHandle::WriteAt(RkSize const in_offset, std::span<RkByte const> const in_buffer) const noexcept
+{
+    RkSize total {0ULL};
+
+    while (m_win_handle && total < in_buffer.size())
+    {
+        RkSize     const position {in_offset + total};
+        DWORD      const chunk    {static_cast<DWORD>(std::min<RkSize>(in_buffer.size() - total, std::numeric_limits<DWORD>::max()))};
+        DWORD            written  {0UL};
+        OVERLAPPED       overlapped {};
+
+        overlapped.Offset     = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32ULL);
+
+        if (!::WriteFile(static_cast<HANDLE>(m_win_handle), in_buffer.data() + total, chunk, &written, &overlapped) || written == 0UL)
+            break;
+
+        total += written;
+    }
+
+    return total;
+}
+
+#pragma endregion
+
+#pragma region Operators
+
+FileHandle& FileHandle::operator=(FileHandle&& in_move) noexcept
+{
+    if (this != &in_move)
+    {
+        if (m_win_handle)
+            CloseHandle(static_cast<HANDLE>(m_win_handle));
+
+        m_win_handle = std::exchange(in_move.m_win_handle, nullptr);
+    }
+
+    return *this;
+}
+
+#pragma endregion
@@ -0,0 +1,50 @@
+#include <string>
+
+#include "Core/ExecutiveSystem/CPU/Metrics/CPUMetricsSnapshot.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+namespace internal
+{
+    static RkVoid WriteWorker(std::ostream& inout_stream, std::string const& in_name, WorkerMetrics::Snapshot const& in_worker)
+    {
+        using Milliseconds = std::chrono::duration<RkDouble, std::milli>;
+
+        std::chrono::nanoseconds const total {in_worker.busy_time + in_worker.idle_time};
+        RkDouble                 const usage {total.count() > 0 ? 100.0 * in_worker.busy_time.count() / total.count() : 0.0};
+
+        inout_stream << in_name << ": "
+                     << in_worker.executed_jobs        << " jobs, "
+                     << in_worker.continuation_resumes << " continuations, "
+                     << in_worker.empty_polls          << " empty polls, "
+                     << in_worker.queue_switches       << " queue switches, "
+                     << usage << "% busy ("
+                     << Milliseconds(in_worker.busy_time).count() << "ms busy, "
+                     << Milliseconds(in_worker.idle_time).count() << "ms idle)\n";
+    }
+}
+
+std::ostream& operator<<(std::ostream& inout_stream, CPUMetricsSnapshot const& in_snapshot)
+{
+    for (RkSize index = 0ULL; index < in_snapshot.workers.size(); ++index)
+        internal::WriteWorker(inout_stream, "CPU " + std::to_string(index), in_snapshot.workers[index]);
+
+    internal::WriteWorker(inout_stream, "Callers", in_snapshot.callers);
+
+    for (RkSize index = 0ULL; index < in_snapshot.queues.size(); ++index)
+    {
+        QueueMetricsSnapshot const& queue {in_snapshot.queues[index]};
+
+        inout_stream << "Queue " << index << ": "
+                     << queue.executed_jobs         << " jobs, "
+                     << queue.empty_polls           << " empty polls, depth "
+                     << queue.depth                 << " (max "
+                     << queue.depth_high_water_mark << "), "
+                     << queue.overflow_count        << " overflows, "
+                     << queue.missed_deadline_count << " missed deadlines\n";
+    }
+
+    return inout_stream;
+}
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,192 @@
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <atomic_queue/atomic_queue.h>
+
+#include "Core/ExecutiveSystem/CPU/CPUParkingLot.hpp"
+#include "Core/ExecutiveSystem/CPU/Timers/CPUTimerWheel.hpp"
+
+USING_RUKEN_NAMESPACE
+
+CPUTimerWheel& CPUTimerWheel::GetInstance() noexcept
+{
+    static CPUTimerWheel instance;
+
+    return instance;
+}
+
+RkUint64 CPUTimerWheel::ToDeadline(TimePoint const in_time_point) const noexcept
+{
+    if (in_time_point <= m_origin)
+        return 0ULL;
+
+    // Rounding up, timers are never allowed to expire early
+    return static_cast<RkUint64>(std::chrono::ceil<Tick>(in_time_point - m_origin).count());
+}
+
+RkVoid CPUTimerWheel::Arm(CPUTimer& in_timer) noexcept
+{
+    m_armed.fetch_add(1ULL, std::memory_order_relaxed);
+
+    in_timer.next = m_pending.load(std::memory_order_relaxed);
+    while (!m_pending.compare_exchange_weak(in_timer.next, &in_timer, std::memory_order_release, std::memory_order_relaxed))
+        atomic_queue::spin_loop_pause();
+
+    // Parked workers might be sleeping past the deadline of this timer
+    CPUParkingLot::GetInstance().Notify();
+}
+
+RkVoid CPUTimerWheel::Insert(CPUTimer* in_timer, CPUTimer*& inout_expired) noexcept
+{
+    if (in_timer->deadline <= m_current)
+    {
+        in_timer->next = inout_expired;
+        inout_expired  = in_timer;
+        return;
+    }
+
+    RkUint64 const delta {in_timer->deadline - m_current};
+    RkSize         level {0ULL};
+    RkSize         slot;
+
+    while (level < level_count - 1ULL && delta >= 1ULL << (level_bits * (level + 1ULL)))
+        ++level;
+
+    // Timers that are too far away to fit in the wheel are parked in the slot cascading last
+    if (delta >= 1ULL << (level_bits * level_count))
+        slot = ((m_current >> (level_bits * level)) - 1ULL) & (level_size - 1ULL);
+    else
+        slot = (in_timer->deadline >> (level_bits * level)) & (level_size - 1ULL);
+
+    in_timer->next       = m_slots[level][slot];
+    m_slots[level][slot] = in_timer;
+}
+
+RkVoid CPUTimerWheel::Cascade(RkSize const in_level, CPUTimer*& inout_expired) noexcept
+{
+    RkSize const slot  {(m_current >> (level_bits * in_level)) & (level_size - 1ULL)};
+    CPUTimer*    timer {std::exchange(m_slots[in_level][slot], nullptr)};
+
+    while (timer)
+        Insert(std::exchange(timer, timer->next), inout_expired);
+}
+
+RkBool CPUTimerWheel::IsLevelEmpty(RkSize const in_level) const noexcept
+{
+    return std::ranges::all_of(m_slots[in_level], [](CPUTimer const* in_timer) { return in_timer == nullptr; });
+}
+
+RkUint64 CPUTimerWheel::ComputeNextExpiry() const noexcept
+{
+    // Level 0 slots hold the timers expiring within the next level_size ticks
+    for (RkUint64 offset {1ULL}; offset <= level_size; ++offset)
+    {
+        if (m_slots[0ULL][(m_current + offset) & (level_size - 1ULL)])
+            return m_current + offset;
+    }
+
+    // Otherwise nothing happens before the first occupied level cascades
+    for (RkSize level {1ULL}; level < level_count; ++level)
+    {
+        if (IsLevelEmpty(level))
+            continue;
+
+        RkUint64 const period {1ULL << (level_bits * level)};
+
+        return (m_current / period + 1ULL) * period;
+    }
+
+    return std::numeric_limits<RkUint64>::max();
+}
+
+RkVoid CPUTimerWheel::Process() noexcept
+{
+    // Fast path, the vast majority of calls will end here
+    if (m_armed.load(std::memory_order_relaxed) == 0ULL)
+        return;
+
+    // Only one worker at a time is allowed to service the wheel, others can go back to work
+    if (m_servicing.exchange(true, std::memory_order_acquire))
+        return;
+
+    RkUint64 const now     {static_cast<RkUint64>(std::chrono::floor<Tick>(Clock::now() - m_origin).count())};
+    CPUTimer*      expired {nullptr};
+    CPUTimer*      pending {m_pending.exchange(nullptr, std::memory_order_acquire)};
+    RkSize   const armed   {m_armed.load(std::memory_order_relaxed)};
+    RkSize         count   {0ULL};
+
+    // If the wheel only contains freshly armed timers, there is no need to walk
+    // through every elapsed tick since the last time the wheel has been serviced
+    for (CPUTimer* timer {pending}; timer; timer = timer->next)
+        ++count;
+
+    if (count == armed)
+        m_current = std::max(m_current, now);
+
+    while (pending)
+        Insert(std::exchange(pending, pending->next), expired);
+
+    while (m_current < now)
+    {
+        // Empty lower levels have nothing to expire nor to cascade, the wheel can directly
+        // jump to the next tick at which the first occupied level cascades instead of walking every tick
+        RkSize empty_levels {0ULL};
+        while (empty_levels < level_count && IsLevelEmpty(empty_levels))
+            ++empty_levels;
+
+        if (empty_levels == level_count)
+        {
+            m_current = now;
+            break;
+        }
+
+        RkUint64 const period {1ULL << (level_bits * empty_levels)};
+
+        m_current = std::min<RkUint64>(now, (m_current / period + 1ULL) * period);
+
+        // Cascading the upper levels when the lower ones wrapped around
+        for (RkSize level {1ULL}; level < level_count; ++level)
+        {
+            if ((m_current & ((1ULL << (level_bits * level)) - 1ULL)) != 0ULL)
+                break;
+
+            Cascade(level, expired);
+        }
+
+        Cascade(0ULL, expired);
+    }
+
+    m_next.store(ComputeNextExpiry(), std::memory_order_relaxed);
+
+    m_servicing.store(false, std::memory_order_release);
+
+    // Notifying owners outside of the servicing lock since this might resume (and destroy) the timers
+    RkSize fired {0ULL};
+    while (expired)
+    {
+        CPUTimer*   const timer {std::exchange(expired, expired->next)};
+        CPUAwaiter* const owner {timer->owner};
+
+        ++fired;
+        owner->OnAwaitedContinuation();
+    }
+
+    if (fired > 0ULL)
+        m_armed.fetch_sub(fired, std::memory_order_relaxed);
+}
+
+CPUTimerWheel::TimePoint CPUTimerWheel::GetNextExpiry() const noexcept
+{
+    if (m_armed.load(std::memory_order_relaxed) == 0ULL)
+        return TimePoint::max();
+
+    // Freshly armed timers are only taken into account once inserted by the next servicing
+    if (m_pending.load(std::memory_order_relaxed) != nullptr)
+        return TimePoint::min();
+
+    RkUint64 const next {m_next.load(std::memory_order_relaxed)};
+    if (next == std::numeric_limits<RkUint64>::max())
+        return TimePoint::max();
+
+    return m_origin + Tick {next};
+}
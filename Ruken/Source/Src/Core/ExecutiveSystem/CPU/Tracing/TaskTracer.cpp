@@ -0,0 +1,215 @@
+#include <fstream>
+
+#include "Core/ExecutiveSystem/CPU/Tracing/TaskTracer.hpp"
+
+#if defined(RUKEN_TASK_TRACING_ENABLED)
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#else
+    #include <x86intrin.h>
+#endif
+
+#include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+
+#endif
+
+USING_RUKEN_NAMESPACE
+
+#if defined(RUKEN_TASK_TRACING_ENABLED)
+
+BEGIN_RUKEN_NAMESPACE
+
+namespace internal
+{
+    static_assert((RUKEN_TASK_TRACING_BUFFER_SIZE & (RUKEN_TASK_TRACING_BUFFER_SIZE - 1)) == 0,
+        "RUKEN_TASK_TRACING_BUFFER_SIZE must be a power of 2");
+
+    struct TaskTraceRecord
+    {
+        RkUint64        timestamp;
+        RkVoid const*   task;
+        RkVoid const*   queue;
+        ETaskTraceEvent event;
+    };
+
+    /**
+     * \brief Single producer ring buffer, only written by its owning thread
+     */
+    struct TaskTraceBuffer
+    {
+        std::string                                                     name;
+        std::atomic<RkUint64>                                           head    {0ULL};
+        std::array <TaskTraceRecord, RUKEN_TASK_TRACING_BUFFER_SIZE>    records {};
+    };
+
+    /**
+     * \brief Owns every buffer created so far. Buffers outlive their threads so that they can still be dumped.
+     */
+    struct TaskTraceRegistry
+    {
+        std::mutex                                    mutex;
+        std::vector<std::unique_ptr<TaskTraceBuffer>> buffers;
+
+        // TSC and clock values sampled at startup, used to convert TSC ticks into microseconds
+        RkUint64                              const   origin_ticks {__rdtsc()};
+        std::chrono::steady_clock::time_point const   origin_time  {std::chrono::steady_clock::now()};
+    };
+
+    static TaskTraceRegistry& GetTaskTraceRegistry() noexcept
+    {
+        static TaskTraceRegistry registry;
+
+        return registry;
+    }
+
+    static thread_local TaskTraceBuffer* current_trace_buffer {nullptr};
+
+    /**
+     * \brief Returns the buffer of the calling thread, creating it on first use
+     */
+    static TaskTraceBuffer& GetTaskTraceBuffer() noexcept
+    {
+        if (current_trace_buffer)
+            return *current_trace_buffer;
+
+        TaskTraceRegistry& registry {GetTaskTraceRegistry()};
+        std::unique_ptr    buffer   {std::make_unique<TaskTraceBuffer>()};
+
+        buffer->name = WorkerInfo::name;
+
+        std::scoped_lock const lock {registry.mutex};
+
+        current_trace_buffer = registry.buffers.emplace_back(std::move(buffer)).get();
+
+        return *current_trace_buffer;
+    }
+
+    static RkVoid WriteJsonString(std::ostream& inout_stream, std::string const& in_string)
+    {
+        inout_stream << '"';
+
+        for (char const character: in_string)
+        {
+            if (character == '"' || character == '\\')
+                inout_stream << '\\';
+
+            if (static_cast<unsigned char>(character) >= 0x20)
+                inout_stream << character;
+        }
+
+        inout_stream << '"';
+    }
+
+    static RkVoid WriteTraceEvent(std::ostream& inout_stream, TaskTraceRecord const& in_record, RkSize const in_thread, RkDouble const in_timestamp)
+    {
+        RkChar const* name  {""};
+        RkChar const* phase {"i"};
+
+        switch (in_record.event)
+        {
+            case ETaskTraceEvent::Spawn:              name = "Spawn";         phase = "i"; break;
+            case ETaskTraceEvent::Resume:             name = "Task";          phase = "B"; break;
+            case ETaskTraceEvent::Suspend:            name = "Task";          phase = "E"; break;
+            case ETaskTraceEvent::Complete:           name = "Complete";      phase = "i"; break;
+            case ETaskTraceEvent::Transfer:           name = "Transfer";      phase = "i"; break;
+            case ETaskTraceEvent::ProcessQueuesBegin: name = "ProcessQueues"; phase = "B"; break;
+            case ETaskTraceEvent::ProcessQueuesEnd:   name = "ProcessQueues"; phase = "E"; break;
+            case ETaskTraceEvent::PopAndRunBegin:     name = "PopAndRun";     phase = "B"; break;
+            case ETaskTraceEvent::PopAndRunEnd:       name = "PopAndRun";     phase = "E"; break;
+        }
+
+        inout_stream << ",\n{\"name\":\"" << name << "\",\"cat\":\"task\",\"ph\":\"" << phase
+                     << "\",\"pid\":0,\"tid\":" << in_thread << ",\"ts\":" << in_timestamp;
+
+        if (phase[0] == 'i')
+            inout_stream << ",\"s\":\"t\"";
+
+        inout_stream << ",\"args\":{\"task\":\"" << in_record.task << "\",\"queue\":\"" << in_record.queue << "\"}}";
+    }
+}
+
+END_RUKEN_NAMESPACE
+
+RkVoid TaskTracer::Record(ETaskTraceEvent const in_event, RkVoid const* in_task, RkVoid const* in_queue) noexcept
+{
+    internal::TaskTraceBuffer& buffer {internal::GetTaskTraceBuffer()};
+    RkUint64            const  head   {buffer.head.load(std::memory_order_relaxed)};
+
+    buffer.records[head & (RUKEN_TASK_TRACING_BUFFER_SIZE - 1)] = {
+        .timestamp = __rdtsc(),
+        .task      = in_task,
+        .queue     = in_queue,
+        .event     = in_event
+    };
+
+    buffer.head.store(head + 1ULL, std::memory_order_release);
+}
+
+RkVoid TaskTracer::DumpChromeTrace(std::ostream& inout_stream)
+{
+    internal::TaskTraceRegistry& registry {internal::GetTaskTraceRegistry()};
+
+    // Calibrating the TSC against the steady clock over the whole lifetime of the tracer
+    RkUint64 const ticks   {__rdtsc() - registry.origin_ticks};
+    RkDouble const elapsed {std::chrono::duration<RkDouble, std::micro>(std::chrono::steady_clock::now() - registry.origin_time).count()};
+    RkDouble const ticks_per_microsecond {elapsed > 0.0 ? static_cast<RkDouble>(ticks) / elapsed : 1.0};
+
+    std::scoped_lock const lock {registry.mutex};
+
+    inout_stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+                 << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"Ruken\"}}";
+
+    for (RkSize thread = 0ULL; thread < registry.buffers.size(); ++thread)
+    {
+        internal::TaskTraceBuffer const& buffer {*registry.buffers[thread]};
+        RkUint64                  const  head   {buffer.head.load(std::memory_order_acquire)};
+        RkUint64                  const  tail   {head > RUKEN_TASK_TRACING_BUFFER_SIZE ? head - RUKEN_TASK_TRACING_BUFFER_SIZE : 0ULL};
+
+        inout_stream << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread << ",\"args\":{\"name\":";
+        internal::WriteJsonString(inout_stream, buffer.name);
+        inout_stream << "}}";
+
+        for (RkUint64 index = tail; index < head; ++index)
+        {
+            internal::TaskTraceRecord const& record {buffer.records[index & (RUKEN_TASK_TRACING_BUFFER_SIZE - 1)]};
+
+            // Events recorded before the registry was created (if any) are clamped to the origin
+            RkDouble const timestamp {record.timestamp > registry.origin_ticks ?
+                static_cast<RkDouble>(record.timestamp - registry.origin_ticks) / ticks_per_microsecond : 0.0};
+
+            internal::WriteTraceEvent(inout_stream, record, thread, timestamp);
+        }
+    }
+
+    inout_stream << "\n]}\n";
+}
+
+#else
+
+RkVoid TaskTracer::DumpChromeTrace(std::ostream& inout_stream)
+{
+    inout_stream << "{\"traceEvents\":[]}\n";
+}
+
+#endif
+
+RkBool TaskTracer::DumpChromeTrace(std::filesystem::path const& in_path)
+{
+    std::ofstream stream {in_path, std::ios::out | std::ios::trunc};
+
+    if (!stream)
+        return false;
+
+    DumpChromeTrace(stream);
+
+    return static_cast<RkBool>(stream);
+}
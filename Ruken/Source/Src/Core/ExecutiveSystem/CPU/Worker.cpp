@@ -1,33 +1,129 @@
+#include <vector>
+#include <utility>
+#include <algorithm>
 #include <functional>
 
+#include "Build/Config.hpp"
+
 #include "Core/ExecutiveSystem/CPU/Worker.hpp"
 #include "Core/ExecutiveSystem/CPU/WorkerInfo.hpp"
+#include "Core/ExecutiveSystem/CPU/CPUParkingLot.hpp"
 #include "Core/ExecutiveSystem/CPU/Queues/CentralProcessingQueue.hpp"
+#include "Core/ExecutiveSystem/CPU/Tracing/TaskTracer.hpp"
+#include "Core/ExecutiveSystem/CPU/Timers/CPUTimerWheel.hpp"
 
 USING_RUKEN_NAMESPACE
 
 Worker::Worker(std::string in_name, std::vector<CentralProcessingQueue*>& in_queues) noexcept:
-    m_queues {in_queues},
-    m_thread {std::bind_front(&Worker::Routine, this), std::move(in_name)}
+    m_queues  {in_queues},
+    m_metrics {},
+    m_thread  {std::bind_front(&Worker::Routine, this), std::move(in_name)}
 {}
 
-RkVoid Worker::ProcessQueues(std::vector<CentralProcessingQueue*> const& in_queues, std::stop_token const& in_stop_token) noexcept
+RkSize Worker::ProcessQueues(std::vector<CentralProcessingQueue*> const& in_queues,
+                             std::stop_token                      const& in_stop_token,
+                             std::chrono::steady_clock::time_point const in_deadline) noexcept
 {
-    // This obviously defeats the whole purpose of making queues but is only temporary
-    // and is meant to be customized for each projects based on the needs.
-    // TODO: Implement a way of customizing the process behavior without modifying this code
+    using Entry = std::pair<CentralProcessingQueue::Clock::time_point, CentralProcessingQueue*>;
+
+    // Reused across calls to avoid any allocation once warmed up
+    thread_local std::vector<Entry> ordered_queues {};
+
+    // Last queue jobs have been taken from, see the queue switches metric
+    thread_local CentralProcessingQueue const* last_queue {nullptr};
+
+    WorkerMetrics* const metrics        {WorkerInfo::metrics};
+    RkSize               executed       {0ULL};
+    RkSize               queue_switches {0ULL};
+
+    // Threads without metrics (see WorkerInfo::metrics) do not pay for the clock
+    CentralProcessingQueue::Clock::time_point const cycle_start {metrics ? CentralProcessingQueue::Clock::now() : CentralProcessingQueue::Clock::time_point {}};
+
+    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::ProcessQueuesBegin, nullptr, nullptr);
+
+    // Expired timers are pushing their tasks back to their queues, this needs to be done before processing them
+    CPUTimerWheel::GetInstance().Process();
+
+    // Queues are served by earliest deadline first, ties are kept in registration order
+    ordered_queues.clear();
     for (CentralProcessingQueue* queue: in_queues)
+        ordered_queues.emplace_back(queue->GetEffectiveDeadline(), queue);
+
+    std::ranges::stable_sort(ordered_queues, {}, &Entry::first);
+
+    for (auto const& [deadline, queue]: ordered_queues)
     {
         WorkerInfo::current_queue = queue;
-        queue->PopAndRun(true, in_stop_token);
+
+        // Sticky workers come back regularly to order the queues again, otherwise urgent jobs could wait behind bulk ones
+        RkSize const queue_executed {queue->PopAndRun(true, in_stop_token, RUKEN_CPU_QUEUE_STICKY_ROUNDS, in_deadline)};
+
+        // Workers are pulling from shared queues, moving to another queue is the closest thing to a steal
+        if (queue_executed > 0ULL && std::exchange(last_queue, queue) != queue)
+            ++queue_switches;
+
+        executed += queue_executed;
+    }
+
+    if (metrics)
+    {
+        RkInt64 const elapsed {std::chrono::duration_cast<std::chrono::nanoseconds>(CentralProcessingQueue::Clock::now() - cycle_start).count()};
+
+        (executed > 0ULL ? metrics->busy_time : metrics->idle_time).fetch_add(elapsed, std::memory_order_relaxed);
+
+        if (queue_switches > 0ULL)
+            metrics->queue_switches.fetch_add(queue_switches, std::memory_order_relaxed);
     }
+
+    RUKEN_TRACE_TASK_EVENT(ETaskTraceEvent::ProcessQueuesEnd, nullptr, nullptr);
+
+    return executed;
+}
+
+RkVoid Worker::Idle(std::vector<CentralProcessingQueue*> const& in_queues,
+                    std::stop_token                      const& in_stop_token,
+                    RkSize&                                     inout_idle_cycles,
+                    std::atomic<RkSize>                  const* in_counter,
+                    std::chrono::steady_clock::time_point const in_deadline) noexcept
+{
+    if (++inout_idle_cycles < RUKEN_CPU_WORKER_IDLE_CYCLES)
+        return;
+
+    inout_idle_cycles = 0ULL;
+
+    WorkerMetrics* const metrics    {WorkerInfo::metrics};
+    auto           const park_start {metrics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point {}};
+
+    CPUParkingLot::GetInstance().Park(in_queues, in_stop_token, in_counter, in_deadline);
+
+    // Parked time is idle time as well, otherwise utilization would only account for the spinning cycles
+    if (metrics)
+        metrics->idle_time.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - park_start).count(), std::memory_order_relaxed);
 }
 
-RkVoid Worker::Routine(std::stop_token&& in_stop_token, std::string&& in_name) const noexcept
+RkVoid Worker::Routine(std::stop_token&& in_stop_token, std::string&& in_name) noexcept
 {
-    WorkerInfo::name = in_name;
+    WorkerInfo::name    = in_name;
+    WorkerInfo::metrics = &m_metrics;
+
+    RkSize idle_cycles {0ULL};
 
     // This loop needs to be as small as possible in order to reduce latency
     while (!in_stop_token.stop_requested())
-        Worker::ProcessQueues(m_queues, in_stop_token);
+    {
+        if (ProcessQueues(m_queues, in_stop_token) > 0ULL)
+            idle_cycles = 0ULL;
+        else
+            Idle(m_queues, in_stop_token, idle_cycles);
+    }
+}
+
+WorkerMetrics const& Worker::GetMetrics() const noexcept
+{
+    return m_metrics;
+}
+
+std::thread::id Worker::GetId() const noexcept
+{
+    return m_thread.get_id();
 }
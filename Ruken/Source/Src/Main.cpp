@@ -1,10 +1,28 @@
-#include "Core/ExecutiveSystem/CPU/CentralProcessingUnit.hpp"
-#include "Core/ServiceProvider.hpp"
+#include "Build/Config.hpp"
+
+#include "Core/Kernel.hpp"
+
+#if defined(RUKEN_EXECUTIVE_BENCHMARKS_ENABLED)
+    #include "Core/ExecutiveSystem/Benchmarks/ExecutiveBenchmarks.hpp"
+#endif
 
 USING_RUKEN_NAMESPACE
 
 int main()
 {
-    // Declaring the context
-    CentralProcessingUnit job_system {};
+    #if defined(RUKEN_EXECUTIVE_BENCHMARKS_ENABLED)
+
+    ExecutiveBenchmarks benchmarks {};
+    benchmarks.Run();
+
+    return benchmarks.DumpJson(RUKEN_EXECUTIVE_BENCHMARKS_OUTPUT) ? 0 : 1;
+
+    #else
+
+    // The workers of the engine are owned by the Scheduler service, see Kernel
+    Kernel kernel {};
+
+    return kernel.Run();
+
+    #endif
 }
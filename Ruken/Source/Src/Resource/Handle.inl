@@ -4,7 +4,7 @@ Handle<TResource_Type>::Handle(Handle const& in_copy) noexcept:
     m_manifest {in_copy.m_manifest}
 {
     if (m_manifest)
-        ++m_manifest->reference_count;
+        m_manifest->AddReference();
 }
 
 template <typename TResource_Type>
@@ -12,22 +12,23 @@ Handle<TResource_Type>::Handle(Handle&& in_move) noexcept:
     m_manifest {std::forward<ResourceManifest*>(in_move.m_manifest)}
 {
     if (m_manifest)
-        ++m_manifest->reference_count;
+        m_manifest->AddReference();
 }
 
 template <typename TResource_Type>
 Handle<TResource_Type>::~Handle()
 {
     if (m_manifest)
-        --m_manifest->reference_count;
+        m_manifest->Release();
 }
 
 template <typename TResource_Type>
 Handle<TResource_Type>::Handle(ResourceManifest* in_manifest):
     m_manifest {in_manifest}
 {
-    if (m_manifest)
-        ++m_manifest->reference_count;
+    // The manifest might have been claimed by a garbage collection since it has been found, see ResourceManifest::TryRetire
+    if (m_manifest && !m_manifest->TryAcquire())
+        m_manifest = nullptr;
 }
 
 template <typename TResource_Type>
@@ -81,7 +82,7 @@ ResourceManifest::ReferenceCountType Handle<TResource_Type>::ReferenceCount() co
     if (!m_manifest)
         return 0;
 
-    return m_manifest->reference_count.load(std::memory_order_acquire);
+    return m_manifest->GetReferenceCount();
 }
 
 template <typename TResource_Type>
@@ -120,47 +121,47 @@ EResourceGCStrategy Handle<TResource_Type>::GCStrategy(EResourceGCStrategy const
 template <typename TResource_Type>
 Handle<TResource_Type>& Handle<TResource_Type>::operator=(ResourceManifest* in_manifest) noexcept
 {
+    // New manifest, referenced before the old one is released in case they are the same
+    if (in_manifest && !in_manifest->TryAcquire())
+        in_manifest = nullptr;
+
     // Old manifest
     if (m_manifest)
-        --m_manifest->reference_count;
+        m_manifest->Release();
 
     m_manifest = in_manifest;
 
-    // New manifest
-    if (m_manifest)
-        ++m_manifest->reference_count;
-
     return *this;
 }
 
 template <typename TResource_Type>
 Handle<TResource_Type>& Handle<TResource_Type>::operator=(Handle const& in_copy) noexcept
 {
-        // Old manifest
+    // New manifest, referenced before the old one is released in case of a self assignment
+    if (in_copy.m_manifest)
+        in_copy.m_manifest->AddReference();
+
+    // Old manifest
     if (m_manifest)
-        --m_manifest->reference_count;
+        m_manifest->Release();
 
     m_manifest = in_copy.m_manifest;
 
-    // New manifest
-    if (m_manifest)
-        ++m_manifest->reference_count;
-
     return *this;
 }
 
 template <typename TResource_Type>
 Handle<TResource_Type>& Handle<TResource_Type>::operator=(Handle&& in_move) noexcept
 {
+    // New manifest, referenced before the old one is released in case of a self assignment
+    if (in_move.m_manifest)
+        in_move.m_manifest->AddReference();
+
     // Old manifest
     if (m_manifest)
-        --m_manifest->reference_count;
+        m_manifest->Release();
 
-    m_manifest = std::forward<ResourceManifest*>(in_move.m_manifest);
-
-    // New manifest
-    if (m_manifest)
-        ++m_manifest->reference_count;
+    m_manifest = in_move.m_manifest;
 
     return *this;
 }
@@ -0,0 +1,28 @@
+#pragma once
+
+constexpr RkUint64 ResourceIdentifier::Hash(std::string_view const in_name) noexcept
+{
+    RkUint64 hash {0xcbf29ce484222325ULL};
+
+    for (RkChar const character: in_name)
+    {
+        hash ^= static_cast<RkUint8>(character);
+        hash *= 0x100000001b3ULL;
+    }
+
+    // 0 is reserved for invalid identifiers, paths hashing to it are remapped and collide with the ones hashing to 1 instead
+    return hash != 0ULL ? hash : 1ULL;
+}
+
+constexpr ResourceIdentifier ResourceIdentifier::FromId(RkUint64 const in_id) noexcept
+{
+    ResourceIdentifier identifier {};
+    identifier.id = in_id;
+
+    return identifier;
+}
+
+consteval ResourceIdentifier operator"" _rid(RkChar const* in_name, RkSize const in_length) noexcept
+{
+    return ResourceIdentifier::FromId(ResourceIdentifier::Hash(std::string_view(in_name, in_length)));
+}
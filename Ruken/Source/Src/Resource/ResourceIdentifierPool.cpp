@@ -0,0 +1,58 @@
+#include <iomanip>
+#include <sstream>
+#include <iostream>
+
+#include "Resource/ResourceIdentifier.hpp"
+#include "Resource/ResourceIdentifierPool.hpp"
+
+USING_RUKEN_NAMESPACE
+
+ResourceIdentifierPool& ResourceIdentifierPool::GetInstance() noexcept
+{
+    static ResourceIdentifierPool instance;
+
+    return instance;
+}
+
+RkUint64 ResourceIdentifierPool::Intern(std::string_view const in_name) noexcept
+{
+    RkUint64 const id {ResourceIdentifier::Hash(in_name)};
+
+    #if defined(RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER)
+
+    {
+        // Most paths are interned more than once, the write lock is only taken for new ones
+        decltype(m_names)::ReadAccess access(m_names);
+
+        auto const name {access->find(id)};
+        if (name != access->cend() && name->second == in_name)
+            return id;
+    }
+
+    decltype(m_names)::WriteAccess access(m_names);
+
+    auto const [name, inserted] {access->try_emplace(id, in_name)};
+    if (!inserted && name->second != in_name)
+        std::cout << "Resource identifier collision between " << name->second << " and " << in_name << std::endl;
+
+    #endif
+
+    return id;
+}
+
+std::string ResourceIdentifierPool::GetName(RkUint64 const in_id) noexcept
+{
+    #if defined(RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER)
+
+    decltype(m_names)::ReadAccess access(m_names);
+
+    if (auto const name {access->find(in_id)}; name != access->cend())
+        return name->second;
+
+    #endif
+
+    std::ostringstream stream {};
+    stream << '#' << std::hex << std::setw(16) << std::setfill('0') << in_id;
+
+    return stream.str();
+}
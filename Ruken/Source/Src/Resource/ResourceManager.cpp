@@ -1,4 +1,5 @@
 
+#include <vector>
 #include <iostream>
 
 #include "Core/ServiceProvider.hpp"
@@ -8,7 +9,7 @@
 
 USING_RUKEN_NAMESPACE
 
-RkVoid ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, ResourceLoadingDescriptor const& in_descriptor)
+CPUTask<SchedulerQueue> ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, ResourceLoadingDescriptor const& in_descriptor)
 {
     in_manifest->status.store(EResourceStatus::Processed, std::memory_order_release);
 
@@ -16,7 +17,7 @@ RkVoid ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, ResourceLo
     
     try
     {
-        in_manifest->data.load(std::memory_order_acquire)->Load(*this, in_descriptor);
+        co_await in_manifest->data.load(std::memory_order_acquire)->Load(*this, in_descriptor);
         in_manifest->status.store(EResourceStatus::Loaded, std::memory_order_release);
 
         --m_current_operation_count;
@@ -45,10 +46,10 @@ RkVoid ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, ResourceLo
     }
 }
 
-RkVoid ResourceManager::ReloadingRoutine(ResourceManifest* in_manifest)
+CPUTask<SchedulerQueue> ResourceManager::ReloadingRoutine(ResourceManifest* in_manifest)
 {
     if (!in_manifest || in_manifest->status.load(std::memory_order_acquire) != EResourceStatus::Loaded)
-        return;
+        co_return;
 
     in_manifest->status.store(EResourceStatus::Processed, std::memory_order_release);
 
@@ -56,7 +57,7 @@ RkVoid ResourceManager::ReloadingRoutine(ResourceManifest* in_manifest)
 
     try
     {
-        in_manifest->data.load(std::memory_order_acquire)->Reload(*this);
+        co_await in_manifest->data.load(std::memory_order_acquire)->Reload(*this);
         in_manifest->status.store(EResourceStatus::Loaded, std::memory_order_release);
 
         --m_current_operation_count;
@@ -84,6 +85,11 @@ RkVoid ResourceManager::ReloadingRoutine(ResourceManifest* in_manifest)
     }
 }
 
+CPUDetachedTask<SchedulerQueue> ResourceManager::ReloadingJob(ResourceManifest* in_manifest)
+{
+    co_await ReloadingRoutine(in_manifest);
+}
+
 RkVoid ResourceManager::UnloadingRoutine(ResourceManifest* in_manifest)
 {
     if (!in_manifest)
@@ -108,24 +114,38 @@ RkVoid ResourceManager::InvalidateResource(ResourceManifest* in_manifest) noexce
     UnloadingRoutine(in_manifest);
 }
 
+RkVoid ResourceManager::RetireManifest(ResourceManifest* in_manifest) noexcept
+{
+    EpochReclaimer::GetInstance().Retire(in_manifest, [](RkVoid* in_pointer) noexcept {
+        // Every caller of RequestManifest that could have found the manifest before it got removed is done at this point.
+        // Handles can no longer be acquired on a retired manifest, the remaining ones (if any) free it once released.
+        static_cast<ResourceManifest*>(in_pointer)->Reclaim();
+    });
+}
+
 ResourceManifest* ResourceManager::RequestManifest(ResourceIdentifier const& in_unique_identifier, RkBool const in_auto_create_manifest) noexcept
 {
-    ManifestsWriteAccess access(m_manifests);
+    while (true)
+    {
+        ResourceManifest* manifest {m_manifests.Find(in_unique_identifier)};
 
-    // If there is no such manifest in the map: adding a new one
-    if (access->find(in_unique_identifier) != access->end())
-        return access.Get()[in_unique_identifier];
+        if (!manifest && in_auto_create_manifest)
+        {
+            // If there is no such manifest in the map: adding a new invalid one
+            ResourceManifest* const created {new ResourceManifest(in_unique_identifier, nullptr, EResourceGCStrategy::ReferenceCount)};
+            manifest = m_manifests.Insert(in_unique_identifier, created);
 
-    ResourceManifest* manifest = nullptr;
+            // Another thread created the manifest first
+            if (manifest != created)
+                delete created;
+        }
 
-    // Creating a new invalid manifest.
-    if (in_auto_create_manifest)
-    {
-        manifest = new ResourceManifest(in_unique_identifier, nullptr, EResourceGCStrategy::ReferenceCount);
-        access.Get()[in_unique_identifier] = manifest;
-    }
+        if (!manifest || !manifest->IsRetired())
+            return manifest;
 
-    return manifest;
+        // A garbage collection claimed the manifest and is about to remove it from the table, looking up its replacement once it is gone
+        std::this_thread::yield();
+    }
 }
 
 RkVoid ResourceManager::Cleanup() noexcept
@@ -134,18 +154,19 @@ RkVoid ResourceManager::Cleanup() noexcept
     while (m_current_operation_count.load(std::memory_order_acquire) > 0)
         std::this_thread::yield();
 
-    ManifestsWriteAccess access(m_manifests);
+    std::vector<ResourceManifest*> manifests {};
+
+    // Manifests still referenced by a handle are retired as well, these handles keep them alive
+    m_manifests.Sweep([] (ResourceManifest& in_manifest) { return in_manifest.TryRetire(true); }, manifests);
 
     // The resources will be unloaded one by one, even if the resource manager gets deleted in the process
-    for (auto& pair : access.Get())
+    for (ResourceManifest* manifest : manifests)
     {
-        m_scheduler_reference.ScheduleTask([&] {
-            InvalidateResource(pair.second);
-            delete pair.second;
+        m_scheduler_reference.ScheduleTask([this, manifest] {
+            InvalidateResource(manifest);
+            RetireManifest(manifest);
         });
     }
-
-    access->clear();
 }
 
 ResourceManager::ResourceManager(ServiceProvider& in_service_provider) noexcept:
@@ -175,8 +196,8 @@ RkVoid ResourceManager::TriggerSceneGC() noexcept
 RkVoid ResourceManager::TriggerReferenceGC() noexcept
 {
     GarbageCollection([] (ResourceManifest const& in_manifest) {
-        return in_manifest.gc_strategy    .load(std::memory_order_acquire) == EResourceGCStrategy::ReferenceCount &&
-               in_manifest.reference_count.load(std::memory_order_acquire) == 0;
+        return in_manifest.gc_strategy.load(std::memory_order_acquire) == EResourceGCStrategy::ReferenceCount &&
+               in_manifest.GetReferenceCount() == 0;
     });    
 }
 
@@ -187,6 +208,9 @@ RkVoid ResourceManager::SetGarbageCollectionMode(EGCCollectionMode const in_coll
 
 RkBool ResourceManager::UnloadResource(ResourceIdentifier const& in_identifier, ESynchronizationMode const in_loading_mode) noexcept
 {
+    // Keeps the manifest alive while it is being checked, see RetireManifest
+    EpochReclaimer::ReadGuard const guard {};
+
     ResourceManifest* manifest = RequestManifest(in_identifier);
 
     if (!manifest || manifest->status != EResourceStatus::Loaded || manifest->gc_strategy != EResourceGCStrategy::Manual)
@@ -196,7 +220,7 @@ RkBool ResourceManager::UnloadResource(ResourceIdentifier const& in_identifier,
         UnloadingRoutine(manifest);
     else
     {
-        m_scheduler_reference.ScheduleTask([&manifest, this] {
+        m_scheduler_reference.ScheduleTask([manifest, this] {
             UnloadingRoutine(manifest);
         });
     }
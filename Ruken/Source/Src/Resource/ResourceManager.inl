@@ -10,68 +10,89 @@ RkVoid ResourceManager::GarbageCollection(TUnary_Predicate in_predicate, RkBool
     if (m_current_operation_count.load(std::memory_order_acquire) > 0u)
         return;
 
-    ManifestsWriteAccess access(m_manifests);
+    std::vector<ResourceManifest*> removed     {};
+    std::vector<ResourceManifest*> invalidated {};
 
-    // The loop doesn't auto increments the iterator because we might need to delete iterators while looping.
-    for (auto iterator = access->begin(); iterator != access->end();)
+    // If clearing invalid resources has been requested, unreferenced manifests are removed as well.
+    // They are claimed first, so that no handle can be acquired on them while they are being removed.
+    // A claimed manifest has to be removed even if it no longer matches the predicate when the shard gets locked.
+    if (in_clear_invalid_resources)
     {
-        if (in_predicate(*iterator->second) && iterator->second->data)
-        {
-            // Scheduling the deletion
-            m_scheduler_reference.ScheduleTask([manifest = iterator->second, in_clear_invalid_resources, this] {
-                InvalidateResource(manifest);
-
-                if (in_clear_invalid_resources && manifest->status.load(std::memory_order_acquire) == EResourceStatus::Invalid)
-                    delete manifest;
-            });
-        }
-
-        // If clearing invalid resources has been requested and the resource is invalid:
-        if (in_clear_invalid_resources && iterator->second->status.load(std::memory_order_acquire) == EResourceStatus::Invalid)
-            iterator = access->erase(iterator);
-        else
-            ++iterator;
+        m_manifests.Sweep([&in_predicate] (ResourceManifest& in_manifest) {
+            return in_manifest.IsRetired() || (in_predicate(std::as_const(in_manifest)) && in_manifest.TryRetire());
+        }, removed);
+    }
+
+    // Manifests still referenced by a handle are only invalidated, the handles keep pointing to valid memory.
+    m_manifests.ForEach([&] (ResourceManifest* in_manifest) {
+        if (in_predicate(*in_manifest) && in_manifest->data)
+            invalidated.emplace_back(in_manifest);
+    });
+
+    // Every shard has been published at this point, removed manifests cannot be found by new lookups anymore.
+    // Callers of RequestManifest hold a read guard until their handle is acquired, see RetireManifest.
+    for (ResourceManifest* manifest : removed)
+    {
+        // Scheduling the deletion
+        m_scheduler_reference.ScheduleTask([manifest, this] {
+            InvalidateResource(manifest);
+            RetireManifest(manifest);
+        });
+    }
+
+    for (ResourceManifest* manifest : invalidated)
+    {
+        m_scheduler_reference.ScheduleTask([manifest, this] {
+            InvalidateResource(manifest);
+        });
     }
 }
 
-template <typename TResource_Type>
-RkVoid ResourceManager::LoadResource(ResourceManifest* in_manifest, ResourceLoadingDescriptor const& in_descriptor, ESynchronizationMode const in_loading_mode) noexcept
+template <typename TResource_Type, LoadingDescriptorType TDescriptor>
+RkVoid ResourceManager::LoadResource(ResourceManifest* in_manifest, TDescriptor const& in_descriptor, ESynchronizationMode const in_loading_mode) noexcept
 {
     if (!in_manifest)
         return;
 
-    {
-        // Since this method is susceptible to be called from multiple threads at once,
-        // this ensures that a resource doesn't gets loaded twice (or more)
-
-        // TODO move this in a special synchronization structure to avoid slowing down the whole manager
-        ManifestsWriteAccess access(m_manifests);
+    // Since this method is susceptible to be called from multiple threads at once,
+    // this ensures that a resource doesn't gets loaded twice (or more): only the thread moving the manifest out of the invalid state loads it
+    EResourceStatus expected {EResourceStatus::Invalid};
+    if (!in_manifest->status.compare_exchange_strong(expected, EResourceStatus::Pending, std::memory_order_acq_rel))
+        return;
 
-        if (in_manifest->status.load(std::memory_order_acquire) != EResourceStatus::Invalid)
-            return;
-
-        in_manifest->status.store(EResourceStatus::Pending, std::memory_order_release);
-        in_manifest->data  .store(new TResource_Type()    , std::memory_order_release);
-    }
+    in_manifest->data.store(new TResource_Type(), std::memory_order_release);
 
+    // The calling thread keeps its descriptor alive and helps the workers until the resource is loaded
     if (in_loading_mode == ESynchronizationMode::Synchronous)
-        return LoadingRoutine(in_manifest, in_descriptor);
+        return m_scheduler_reference.WaitForTask(LoadingRoutine(in_manifest, in_descriptor));
 
-    m_scheduler_reference.ScheduleTask([in_manifest, &in_descriptor, this] {
-        LoadingRoutine(in_manifest, in_descriptor);
-    });
+    // The job might run after the caller is done with its descriptor
+    LoadingJob(in_manifest, in_descriptor);
 }
 
-template <typename TResource_Type>
-Handle<TResource_Type> ResourceManager::RequestResource(ResourceIdentifier const& in_unique_identifier, ResourceLoadingDescriptor const& in_descriptor, ESynchronizationMode const in_loading_mode) noexcept
+template <LoadingDescriptorType TDescriptor>
+CPUDetachedTask<SchedulerQueue> ResourceManager::LoadingJob(ResourceManifest* in_manifest, TDescriptor in_descriptor)
 {
-    ResourceManifest* manifest = RequestManifest(in_unique_identifier);
+    co_await LoadingRoutine(in_manifest, in_descriptor);
+}
+
+template <typename TResource_Type, LoadingDescriptorType TDescriptor>
+Handle<TResource_Type> ResourceManager::RequestResource(ResourceIdentifier const& in_unique_identifier, TDescriptor const& in_descriptor, ESynchronizationMode const in_loading_mode) noexcept
+{
+    // Keeps the manifest alive until the returned handle references it, see RetireManifest
+    EpochReclaimer::ReadGuard const guard {};
+
+    Handle<TResource_Type> handle {};
+
+    // The manifest might be claimed by a garbage collection before the handle is acquired, requesting its replacement in that case
+    while (!handle.m_manifest)
+        handle = RequestManifest(in_unique_identifier);
 
     // If the resource isn't currently loaded: loading it
-    if (manifest->status.load(std::memory_order_acquire) == EResourceStatus::Invalid)
-        LoadResource<TResource_Type>(manifest, in_descriptor, in_loading_mode);
+    if (handle.m_manifest->status.load(std::memory_order_acquire) == EResourceStatus::Invalid)
+        LoadResource<TResource_Type>(handle.m_manifest, in_descriptor, in_loading_mode);
 
-    return std::move(Handle<TResource_Type>(manifest));
+    return handle;
 }
 
 template <typename TResource_Type>
@@ -82,13 +103,9 @@ Handle<TResource_Type> ResourceManager::ReloadResource(Handle<TResource_Type> co
         return in_handle;
 
     if (in_loading_mode == ESynchronizationMode::Synchronous)
-        ReloadingRoutine(in_handle.m_manifest);
+        m_scheduler_reference.WaitForTask(ReloadingRoutine(in_handle.m_manifest));
     else
-    {
-        m_scheduler_reference.ScheduleTask([&in_handle, this] {
-            ReloadingRoutine(in_handle.m_manifest);
-        });
-    }
+        ReloadingJob(in_handle.m_manifest);
 
     return in_handle;
 }
@@ -96,40 +113,45 @@ Handle<TResource_Type> ResourceManager::ReloadResource(Handle<TResource_Type> co
 template <typename TResource_Type>
 Handle<TResource_Type> ResourceManager::ReferenceResource(ResourceIdentifier const& in_unique_identifier, TResource_Type* in_resource, EResourceGCStrategy const in_strategy) noexcept
 {
-    ManifestsWriteAccess access(m_manifests);
-
-    // If there is already a manifest with the target name or the resource is an empty pointer
-    if (access->find(in_unique_identifier) != access->end() || !in_resource)
+    // If the resource is an empty pointer
+    if (!in_resource)
         return Handle<TResource_Type>(nullptr);
 
-    // Otherwise, referencing the resource
-    ResourceManifest* manifest = new ResourceManifest();
-    access.Get()[in_unique_identifier] = manifest;
-
-    manifest->gc_strategy    = in_strategy;
-    manifest->data            = in_resource;
+    // The manifest is complete before being inserted, lookups can find it right away
+    ResourceManifest* manifest = new ResourceManifest(in_unique_identifier, in_resource, in_strategy);
     manifest->status.store(EResourceStatus::Loaded, std::memory_order_release);
 
-    return Handle<TResource_Type>(manifest);
+    // Referenced before being inserted, a garbage collection cannot claim the manifest in between
+    Handle<TResource_Type> handle(manifest);
+
+    // If there is already a manifest with the target name
+    if (m_manifests.Insert(in_unique_identifier, manifest) != manifest)
+    {
+        // The resource has not been referenced, its ownership stays with the caller
+        handle = nullptr;
+        delete manifest;
+    }
+
+    return handle;
 }
 
 template <typename TResource_Type>
 Handle<TResource_Type> ResourceManager::ReloadResource(ResourceIdentifier const& in_unique_identifier, ESynchronizationMode const in_loading_mode) noexcept
 {
-    ResourceManifest* manifest = RequestManifest(in_unique_identifier, false);
-    
+    // Keeps the manifest alive until the returned handle references it, see RetireManifest
+    EpochReclaimer::ReadGuard const guard {};
+
+    // Referencing the manifest first prevents any garbage collection from claiming it during the reload
+    Handle<TResource_Type> handle(RequestManifest(in_unique_identifier, false));
+
     // Cannot reload an unloaded or invalid manifest
-    if (!manifest || manifest->status != EResourceStatus::Loaded)
-        return Handle<TResource_Type>(manifest);
+    if (!handle.Available())
+        return handle;
 
     if (in_loading_mode == ESynchronizationMode::Synchronous)
-        ReloadingRoutine(manifest);
+        m_scheduler_reference.WaitForTask(ReloadingRoutine(handle.m_manifest));
     else
-    {
-        m_scheduler_reference.ScheduleTask([&manifest, this] {
-            ReloadingRoutine(manifest);
-        });
-    }
+        ReloadingJob(handle.m_manifest);
 
-    return Handle<TResource_Type>(manifest);
+    return handle;
 }
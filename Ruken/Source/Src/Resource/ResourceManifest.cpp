@@ -4,37 +4,79 @@
 USING_RUKEN_NAMESPACE
 
 ResourceManifest::ResourceManifest() noexcept:
-#ifdef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
-    m_identifier    {""},
-#endif
-    data            {nullptr},
-    reference_count {0},
-    gc_strategy        {EResourceGCStrategy::ReferenceCount},
+    m_identifier      {},
+    m_reference_count {0},
+    data              {nullptr},
+    gc_strategy       {EResourceGCStrategy::ReferenceCount},
     status            {EResourceStatus::Invalid}
 {}
 
 ResourceManifest::ResourceManifest(ResourceIdentifier const& in_identifier, class IResource* in_data, EResourceGCStrategy const in_gc_strategy) noexcept:
-#ifdef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
-    m_identifier    {in_identifier},
-#endif
-    data            {in_data},
-    reference_count {0},
-    gc_strategy        {in_gc_strategy},
+    m_identifier      {in_identifier},
+    m_reference_count {0},
+    data              {in_data},
+    gc_strategy       {in_gc_strategy},
     status            {EResourceStatus::Invalid}
 {}
 
-#ifdef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
-
-ResourceIdentifier const& ResourceManifest::GetIdentifier() const noexcept
+ResourceIdentifier ResourceManifest::GetIdentifier() const noexcept
 {
     return m_identifier;
 }
 
-#else
+ResourceManifest::ReferenceCountType ResourceManifest::GetReferenceCount() const noexcept
+{
+    return m_reference_count.load(std::memory_order_acquire) & ~(retired_flag | reclaimed_flag);
+}
 
-ResourceIdentifier ResourceManifest::GetIdentifier() const noexcept
+RkBool ResourceManifest::IsRetired() const noexcept
+{
+    return (m_reference_count.load(std::memory_order_acquire) & retired_flag) != 0U;
+}
+
+RkBool ResourceManifest::TryAcquire() noexcept
 {
-    return ResourceIdentifier("");
+    ReferenceCountType count {m_reference_count.load(std::memory_order_relaxed)};
+
+    do
+    {
+        // A garbage collection claimed the manifest first
+        if (count & retired_flag)
+            return false;
+    }
+    while (!m_reference_count.compare_exchange_weak(count, count + 1U, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    return true;
 }
 
-#endif
\ No newline at end of file
+RkVoid ResourceManifest::AddReference() noexcept
+{
+    m_reference_count.fetch_add(1U, std::memory_order_relaxed);
+}
+
+RkVoid ResourceManifest::Release() noexcept
+{
+    if (m_reference_count.fetch_sub(1U, std::memory_order_acq_rel) == (retired_flag | reclaimed_flag | 1U))
+        delete this;
+}
+
+RkBool ResourceManifest::TryRetire(RkBool const in_force) noexcept
+{
+    if (in_force)
+    {
+        m_reference_count.fetch_or(retired_flag, std::memory_order_acq_rel);
+        return true;
+    }
+
+    ReferenceCountType expected {0U};
+
+    // Handles can only be acquired while the manifest is not retired, claiming an unreferenced manifest guarantees it stays so
+    return m_reference_count.compare_exchange_strong(expected, retired_flag, std::memory_order_acq_rel);
+}
+
+RkVoid ResourceManifest::Reclaim() noexcept
+{
+    // Once reclaimed, the manifest is freed by whoever drops the last reference: this call or the last handle
+    if (m_reference_count.fetch_or(reclaimed_flag, std::memory_order_acq_rel) == retired_flag)
+        delete this;
+}
@@ -0,0 +1,34 @@
+#include <bit>
+
+#include "Resource/ResourceManifestTable.hpp"
+
+USING_RUKEN_NAMESPACE
+
+ResourceManifestTable::Shard& ResourceManifestTable::GetShard(ResourceIdentifier const& in_identifier) noexcept
+{
+    // Fibonacci hashing, the shard is picked from the high bits since the maps of the shards are using the low ones
+    RkUint64 const hash {in_identifier.id * 0x9E3779B97F4A7C15ULL};
+
+    return m_shards[hash >> (64 - std::countr_zero(shard_count))];
+}
+
+ResourceManifest* ResourceManifestTable::Find(ResourceIdentifier const& in_identifier) noexcept
+{
+    SynchronizedRcu<ShardType>::ReadAccess access(GetShard(in_identifier).manifests);
+
+    auto const manifest {access->find(in_identifier.id)};
+
+    return manifest != access->end() ? manifest->second : nullptr;
+}
+
+ResourceManifest* ResourceManifestTable::Insert(ResourceIdentifier const& in_identifier, ResourceManifest* in_manifest) noexcept
+{
+    // Most of the time, the identifier already has a manifest and the shard does not need to be copied
+    if (ResourceManifest* const manifest {Find(in_identifier)})
+        return manifest;
+
+    SynchronizedRcu<ShardType>::WriteAccess access(GetShard(in_identifier).manifests);
+
+    // The manifest might have been inserted by another thread in the meantime
+    return access->try_emplace(in_identifier.id, in_manifest).first->second;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+template <typename TVisitor>
+RkVoid ResourceManifestTable::ForEach(TVisitor in_visitor) noexcept
+{
+    for (Shard& shard: m_shards)
+    {
+        typename SynchronizedRcu<ShardType>::ReadAccess access(shard.manifests);
+
+        for (auto const& [id, manifest]: *access)
+            in_visitor(manifest);
+    }
+}
+
+template <typename TPredicate>
+RkVoid ResourceManifestTable::Sweep(TPredicate in_predicate, std::vector<ResourceManifest*>& out_removed) noexcept
+{
+    for (Shard& shard: m_shards)
+    {
+        // Copying and publishing a shard is costly, most shards have nothing to remove
+        {
+            typename SynchronizedRcu<ShardType>::ReadAccess access(shard.manifests);
+
+            if (std::ranges::none_of(*access, [&in_predicate](auto const& in_entry) { return in_predicate(*in_entry.second); }))
+                continue;
+        }
+
+        // Lookups on this shard keep using the current version until the sweep of the shard is published
+        typename SynchronizedRcu<ShardType>::WriteAccess access(shard.manifests);
+
+        // The loop doesn't auto increments the iterator because we might need to delete iterators while looping.
+        // The predicate is evaluated again, the manifests might have changed since the scan.
+        for (auto iterator = access->begin(); iterator != access->end();)
+        {
+            if (in_predicate(*iterator->second))
+            {
+                out_removed.emplace_back(iterator->second);
+                iterator = access->erase(iterator);
+            }
+            else
+                ++iterator;
+        }
+    }
+}
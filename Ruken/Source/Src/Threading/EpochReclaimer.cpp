@@ -0,0 +1,94 @@
+#include <limits>
+#include <algorithm>
+
+#include "Threading/EpochReclaimer.hpp"
+
+USING_RUKEN_NAMESPACE
+
+EpochReclaimer::ReadGuard::ReadGuard() noexcept
+{
+    ThreadRecord& record {GetThreadRecord()};
+
+    // The announcement must be visible before any shared pointer is loaded, hence the sequentially consistent store.
+    // Writers advance the epoch after unlinking objects, an announced epoch can only be older than the objects it sees.
+    if (record.depth++ == 0ULL)
+        record.epoch.store(GetInstance().m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+}
+
+EpochReclaimer::ReadGuard::~ReadGuard() noexcept
+{
+    ThreadRecord& record {GetThreadRecord()};
+
+    if (--record.depth == 0ULL)
+        record.epoch.store(0ULL, std::memory_order_release);
+}
+
+EpochReclaimer::ThreadRegistration::ThreadRegistration() noexcept
+{
+    EpochReclaimer& reclaimer {GetInstance()};
+
+    std::scoped_lock const lock {reclaimer.m_mutex};
+
+    reclaimer.m_records.emplace_back(&record);
+}
+
+EpochReclaimer::ThreadRegistration::~ThreadRegistration() noexcept
+{
+    EpochReclaimer& reclaimer {GetInstance()};
+
+    std::scoped_lock const lock {reclaimer.m_mutex};
+
+    std::erase(reclaimer.m_records, &record);
+}
+
+EpochReclaimer::~EpochReclaimer() noexcept
+{
+    // Every reader is gone by now, nothing can be accessed anymore
+    for (RetiredObject const& retired: m_retired)
+        retired.deleter(retired.object);
+}
+
+EpochReclaimer::ThreadRecord& EpochReclaimer::GetThreadRecord() noexcept
+{
+    thread_local ThreadRegistration registration {};
+
+    return registration.record;
+}
+
+EpochReclaimer& EpochReclaimer::GetInstance() noexcept
+{
+    static EpochReclaimer instance;
+
+    return instance;
+}
+
+RkVoid EpochReclaimer::Reclaim() noexcept
+{
+    // Oldest epoch announced by a reader, retired objects tagged with an older or equal epoch cannot be reached anymore
+    RkUint64 oldest_epoch {std::numeric_limits<RkUint64>::max()};
+
+    for (ThreadRecord const* record: m_records)
+        if (RkUint64 const epoch {record->epoch.load(std::memory_order_seq_cst)}; epoch != 0ULL)
+            oldest_epoch = std::min(oldest_epoch, epoch);
+
+    auto const reclaimable {std::ranges::partition(m_retired, [oldest_epoch](RetiredObject const& in_retired) {
+        return in_retired.epoch > oldest_epoch;
+    })};
+
+    for (RetiredObject const& retired: reclaimable)
+        retired.deleter(retired.object);
+
+    m_retired.erase(reclaimable.begin(), reclaimable.end());
+}
+
+RkVoid EpochReclaimer::Retire(RkVoid* const in_object, Deleter const in_deleter) noexcept
+{
+    // Readers announcing the new epoch (or any later one) started after the object has been unlinked
+    RkUint64 const epoch {m_epoch.fetch_add(1ULL, std::memory_order_seq_cst) + 1ULL};
+
+    std::scoped_lock const lock {m_mutex};
+
+    m_retired.emplace_back(RetiredObject {.object = in_object, .deleter = in_deleter, .epoch = epoch});
+
+    Reclaim();
+}
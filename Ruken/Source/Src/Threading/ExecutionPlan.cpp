@@ -1,88 +1,190 @@
-
-#include <latch>
+#include <algorithm>
 
 #include "Threading/Scheduler.hpp"
 #include "Threading/ExecutionPlan.hpp"
 
 USING_RUKEN_NAMESPACE
 
+RkBool ExecutionPlan::Prepare() noexcept
+{
+    if (m_prepared)
+        return true;
+
+    std::vector<RkSize> remaining (m_nodes.size());
+
+    m_order.clear();
+    m_order.reserve(m_nodes.size());
+
+    // Kahn's algorithm
+    for (NodeId node = 0ULL; node < m_nodes.size(); ++node)
+    {
+        remaining[node] = m_nodes[node].predecessors;
+
+        if (remaining[node] == 0ULL)
+            m_order.emplace_back(node);
+    }
+
+    for (RkSize index = 0ULL; index < m_order.size(); ++index)
+    {
+        for (NodeId const successor: m_nodes[m_order[index]].successors)
+            if (--remaining[successor] == 0ULL)
+                m_order.emplace_back(successor);
+    }
+
+    // Some nodes were never released, the plan contains a cycle
+    if (m_order.size() != m_nodes.size())
+        return false;
+
+    // The priority of a node is the cost of the longest chain starting from it, computed from the leaves
+    for (auto node = m_order.rbegin(); node != m_order.rend(); ++node)
+    {
+        RkSize longest_successor {0ULL};
+
+        for (NodeId const successor: m_nodes[*node].successors)
+            longest_successor = std::max<RkSize>(longest_successor, m_nodes[successor].priority);
+
+        m_nodes[*node].priority = m_nodes[*node].cost + longest_successor;
+    }
+
+    auto const by_priority = [this](NodeId const in_lhs, NodeId const in_rhs) {
+        return m_nodes[in_lhs].priority > m_nodes[in_rhs].priority;
+    };
+
+    for (Node& node: m_nodes)
+        std::ranges::stable_sort(node.successors, by_priority);
+
+    m_roots.clear();
+    for (NodeId node = 0ULL; node < m_nodes.size(); ++node)
+        if (m_nodes[node].predecessors == 0ULL)
+            m_roots.emplace_back(node);
+
+    std::ranges::stable_sort(m_roots, by_priority);
+
+    m_counters = std::make_unique<std::atomic<RkSize>[]>(m_nodes.size() + 1ULL);
+    m_prepared = true;
+
+    return true;
+}
+
+RkVoid ExecutionPlan::ExecuteNode(Scheduler& in_scheduler, NodeId in_node) noexcept
+{
+    std::atomic<RkSize>& remaining_nodes {m_counters[m_nodes.size()]};
+
+    while (true)
+    {
+        m_nodes[in_node].instruction();
+
+        NodeId next      {0ULL};
+        RkBool has_next  {false};
+
+        for (NodeId const successor: m_nodes[in_node].successors)
+        {
+            if (m_counters[successor].fetch_sub(1ULL, std::memory_order_acq_rel) != 1ULL)
+                continue;
+
+            // Successors are sorted by priority, the first released one is the most critical
+            // and is directly executed by this thread instead of going through the scheduler
+            if (!has_next)
+            {
+                next     = successor;
+                has_next = true;
+            }
+            else
+                in_scheduler.ScheduleTask([this, &in_scheduler, successor] {
+                    ExecuteNode(in_scheduler, successor);
+                });
+        }
+
+        // The plan might be destroyed as soon as the last node is done
+        if (Scheduler::ReleaseCounter(remaining_nodes) || !has_next)
+            return;
+
+        in_node = next;
+    }
+}
+
 RkVoid ExecutionPlan::ResetPlan() noexcept
 {
-    m_current_pack_size = 0;
+    m_previous_pack_begin = 0ULL;
+    m_current_pack_begin  = 0ULL;
+    m_prepared            = false;
 
-    m_packs       .clear();
-    m_instructions.clear();
+    m_nodes.clear();
+    m_order.clear();
+    m_roots.clear();
 }
 
-RkVoid ExecutionPlan::AddInstruction(Job&& in_instruction) noexcept
+ExecutionPlan::NodeId ExecutionPlan::AddInstruction(Job&& in_instruction, RkSize const in_cost) noexcept
 {
+    NodeId const node {m_nodes.size()};
+
     // Adding the new instruction
-    m_instructions.emplace_back(std::forward<Job>(in_instruction));
+    m_nodes.emplace_back(Node {
+        .instruction = std::forward<Job>(in_instruction),
+        .cost        = in_cost
+    });
 
-    // Increasing the pack size
-    m_current_pack_size++;
+    // Depending on every instruction of the previous pack
+    for (NodeId before = m_previous_pack_begin; before < m_current_pack_begin; ++before)
+        AddDependency(before, node);
+
+    m_prepared = false;
+
+    return node;
+}
+
+RkVoid ExecutionPlan::AddDependency(NodeId const in_before, NodeId const in_after) noexcept
+{
+    m_nodes[in_before].successors.emplace_back(in_after);
+    m_nodes[in_after ].predecessors++;
+
+    m_prepared = false;
 }
 
 RkVoid ExecutionPlan::EndInstructionPack() noexcept
 {
     // If there is no pack to wrap up, returning
-    if (m_current_pack_size == 0ULL)
+    if (m_current_pack_begin == m_nodes.size())
         return;
 
-    m_packs.emplace_back(m_current_pack_size);
-    m_current_pack_size = 0ULL;
+    m_previous_pack_begin = m_current_pack_begin;
+    m_current_pack_begin  = m_nodes.size();
 }
 
-RkVoid ExecutionPlan::ExecutePlanAsynchronously(Scheduler& in_scheduler) const noexcept
+RkBool ExecutionPlan::ExecutePlanAsynchronously(Scheduler& in_scheduler) noexcept
 {
-    std::vector<std::latch*> latches {m_packs.size()};
+    if (!Prepare())
+        return false;
 
-    // Creating the latches
-    for (RkSize index = 0ULL; index < m_packs.size(); ++index)
-        latches[index] = new std::latch(static_cast<ptrdiff_t>(m_packs[index]));
+    if (m_nodes.empty())
+        return true;
 
-    // Creating the jobs
-    RkSize instruction_index = 0ULL;
+    for (NodeId node = 0ULL; node < m_nodes.size(); ++node)
+        m_counters[node].store(m_nodes[node].predecessors, std::memory_order_relaxed);
 
-    for(RkSize pack_index = 0ULL; pack_index < m_packs.size(); ++pack_index)
-    {
-        RkSize const start_instruction_index {instruction_index};
+    m_counters[m_nodes.size()].store(m_nodes.size(), std::memory_order_release);
 
-        for(;instruction_index < start_instruction_index + m_packs[pack_index]; ++instruction_index)
-        {
-            // FIXME: Scheduling every job right away
-            //
-            // This will consume every threads of the thread pool at once if there are more instructions than threads
-            // This might be a problem later on since some threads are consumed
-            // to wait other instructions, resulting in a potential stall if anything else needs to be executed asynchronously in the same time
-            in_scheduler.ScheduleTask([this, &latches, pack_index, instruction_index] {
-
-                // Waiting for the previous instruction pack to be done
-                // (If there is one)
-                if (pack_index > 0)
-                    latches[pack_index - 1]->wait();
-
-                // Executing the current instruction
-                m_instructions[instruction_index]();
-
-                // Notifying the pack that one instruction has been done
-                // If the pack is completed, this will allow the next pack to start execution
-                latches[pack_index]->count_down();
-            });
-        }
-    }
+    // Roots are sorted by priority, the most critical ones are scheduled first
+    for (NodeId const root: m_roots)
+        in_scheduler.ScheduleTask([this, &in_scheduler, root] {
+            ExecuteNode(in_scheduler, root);
+        });
 
-    // Waiting for the last instruction pack to be executed
+    // Waiting for the last instruction to be executed
     // ie. waiting for the plan to be executed
-    latches[latches.size() - 1]->wait();
+    in_scheduler.WaitUntilZero(m_counters[m_nodes.size()]);
 
-    for(std::latch const* latch: latches)
-        delete latch;
+    return true;
 }
 
-RkVoid ExecutionPlan::ExecutePlanSynchronously() const noexcept
+RkBool ExecutionPlan::ExecutePlanSynchronously() noexcept
 {
+    if (!Prepare())
+        return false;
+
     // Synchronous execution of the plan
-    for (auto&& instruction: m_instructions)
-        instruction();
+    for (NodeId const node: m_order)
+        m_nodes[node].instruction();
+
+    return true;
 }
@@ -0,0 +1,103 @@
+#include <utility>
+#include <algorithm>
+
+#include "Threading/LockProfiler.hpp"
+
+USING_RUKEN_NAMESPACE
+
+LockProfiler& LockProfiler::GetInstance() noexcept
+{
+    static LockProfiler instance;
+
+    return instance;
+}
+
+#if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+LockProfiler::LockStatistics& LockProfiler::GetStatistics(std::string_view const in_name) noexcept
+{
+    std::scoped_lock const lock {m_mutex};
+
+    auto statistics {m_statistics.find(in_name)};
+    if (statistics == m_statistics.end())
+        statistics = m_statistics.emplace(std::string {in_name}, std::make_unique<LockStatistics>()).first;
+
+    return *statistics->second;
+}
+
+RkVoid LockProfiler::RecordRelease(AccessStatistics& inout_statistics, std::chrono::steady_clock::time_point const in_acquired) noexcept
+{
+    RkInt64 const hold {std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - in_acquired).count()};
+
+    inout_statistics.total_hold_time.fetch_add(hold, std::memory_order_relaxed);
+
+    RkInt64 max_hold {inout_statistics.max_hold_time.load(std::memory_order_relaxed)};
+    while (hold > max_hold && !inout_statistics.max_hold_time.compare_exchange_weak(max_hold, hold, std::memory_order_relaxed));
+}
+
+#endif
+
+std::vector<LockProfiler::LockReport> LockProfiler::GetReport() noexcept
+{
+    std::vector<LockReport> reports {};
+
+    #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+    auto const to_report = [](AccessStatistics const& in_statistics) {
+        return AccessReport {
+            .acquires           = in_statistics.acquires          .load(std::memory_order_relaxed),
+            .contended_acquires = in_statistics.contended_acquires.load(std::memory_order_relaxed),
+            .total_wait_time    = std::chrono::nanoseconds {in_statistics.total_wait_time.load(std::memory_order_relaxed)},
+            .max_wait_time      = std::chrono::nanoseconds {in_statistics.max_wait_time  .load(std::memory_order_relaxed)},
+            .total_hold_time    = std::chrono::nanoseconds {in_statistics.total_hold_time.load(std::memory_order_relaxed)},
+            .max_hold_time      = std::chrono::nanoseconds {in_statistics.max_hold_time  .load(std::memory_order_relaxed)}
+        };
+    };
+
+    {
+        std::scoped_lock const lock {m_mutex};
+
+        reports.reserve(m_statistics.size());
+        for (auto const& [name, statistics]: m_statistics)
+        {
+            LockReport report {.name = name, .read = to_report(statistics->read), .write = to_report(statistics->write)};
+
+            // Names registered by default but never locked (renamed instances for instance) are not worth reporting
+            if (report.read.acquires + report.write.acquires > 0ULL)
+                reports.emplace_back(std::move(report));
+        }
+    }
+
+    // The hottest locks are the ones threads spent the most time waiting on
+    std::ranges::sort(reports, std::greater {}, [](LockReport const& in_report) {
+        return in_report.read.total_wait_time + in_report.write.total_wait_time;
+    });
+
+    #endif
+
+    return reports;
+}
+
+RkVoid LockProfiler::DumpReport(std::ostream& inout_stream, RkSize const in_max_locks) noexcept
+{
+    using Microseconds = std::chrono::duration<RkDouble, std::micro>;
+
+    std::vector<LockReport> const reports {GetReport()};
+
+    for (RkSize index = 0ULL; index < std::min(in_max_locks, reports.size()); ++index)
+    {
+        for (auto const& [mode, access]: {std::pair {"read ", &reports[index].read}, std::pair {"write", &reports[index].write}})
+        {
+            if (access->acquires == 0ULL)
+                continue;
+
+            inout_stream << reports[index].name << " (" << mode << "): "
+                         << access->acquires           << " acquires, "
+                         << access->contended_acquires << " contended, wait "
+                         << Microseconds(access->total_wait_time).count() << "us (max "
+                         << Microseconds(access->max_wait_time)  .count() << "us), hold "
+                         << Microseconds(access->total_hold_time).count() << "us (max "
+                         << Microseconds(access->max_hold_time)  .count() << "us)\n";
+        }
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+template <typename TLock>
+std::chrono::steady_clock::time_point LockProfiler::Acquire(TLock& inout_lock, AccessStatistics& inout_statistics) noexcept
+{
+    inout_statistics.acquires.fetch_add(1ULL, std::memory_order_relaxed);
+
+    // Uncontended acquires are not timed at all, keeping the profiled build as close as possible to the regular one
+    if (inout_lock.try_lock())
+        return std::chrono::steady_clock::now();
+
+    std::chrono::steady_clock::time_point const start {std::chrono::steady_clock::now()};
+
+    inout_lock.lock();
+
+    std::chrono::steady_clock::time_point const acquired {std::chrono::steady_clock::now()};
+    RkInt64                               const wait     {std::chrono::duration_cast<std::chrono::nanoseconds>(acquired - start).count()};
+
+    inout_statistics.contended_acquires.fetch_add(1ULL, std::memory_order_relaxed);
+    inout_statistics.total_wait_time   .fetch_add(wait, std::memory_order_relaxed);
+
+    RkInt64 max_wait {inout_statistics.max_wait_time.load(std::memory_order_relaxed)};
+    while (wait > max_wait && !inout_statistics.max_wait_time.compare_exchange_weak(max_wait, wait, std::memory_order_relaxed));
+
+    return acquired;
+}
@@ -1,24 +1,29 @@
 
+#include <mutex>
+#include <sstream>
+#include <condition_variable>
+
 #include "Build/Config.hpp"
 #include "Threading/Scheduler.hpp"
 #include "Core/ServiceProvider.hpp"
+#include "Core/ExecutiveSystem/CPU/CPUParkingLot.hpp"
 
 USING_RUKEN_NAMESPACE
 
 Scheduler::Scheduler(ServiceProvider& in_service_provider, RkUint16 const in_workers_count) noexcept:
     Service<Scheduler> {in_service_provider},
-    m_workers          {in_workers_count == 0U ? std::thread::hardware_concurrency() - 1 : in_workers_count},
-    m_running          {true}
+    m_queues           {&SchedulerQueue::GetInstance()},
+    m_running          {true},
+    m_pending_jobs     {0ULL},
+    m_processing_unit  {in_workers_count == 0U ? std::thread::hardware_concurrency() - 1ULL : in_workers_count, m_queues},
+    m_metrics_logging  {}
 {
     #if defined(RUKEN_LOGGING_ENABLED)
 
         m_logger = m_service_provider.LocateService<Logger>()->AddChild("scheduler");
-        m_logger->Info("Spawning " + std::to_string(m_workers.size()) + " workers");
+        m_logger->Info("Spawning " + std::to_string(m_processing_unit.GetWorkers().size()) + " workers");
 
     #endif
-
-    for (OldWorker& worker : m_workers)
-        worker.Execute(&Scheduler::WorkersJob, this);
 }
 
 Scheduler::~Scheduler()
@@ -26,12 +31,43 @@ Scheduler::~Scheduler()
     Shutdown();
 }
 
+CPUDetachedTask<SchedulerQueue> Scheduler::ExecuteJob(Job in_job) noexcept
+{
+    // Jobs still queued once the scheduler has been shut down are dropped
+    if (m_running.load(std::memory_order_acquire))
+        in_job();
+
+    ReleaseCounter(m_pending_jobs);
+
+    co_return;
+}
+
+CPUDetachedTask<SchedulerQueue> Scheduler::AwaitTask(CPUTask<SchedulerQueue> in_task,
+                                                     std::atomic<RkSize>&    inout_remaining,
+                                                     std::exception_ptr&     out_exception) noexcept
+{
+    try
+    {
+        co_await in_task;
+    }
+    catch (...)
+    {
+        out_exception = std::current_exception();
+    }
+
+    // The waiting thread may return as soon as the counter is released
+    ReleaseCounter(inout_remaining);
+}
+
 RkVoid Scheduler::ScheduleTask(Job&& in_task) noexcept
 {
     if (!m_running.load(std::memory_order_acquire))
         return;
 
-    m_job_queue.Enqueue(std::forward<Job>(in_task));
+    m_pending_jobs.fetch_add(1ULL, std::memory_order_acq_rel);
+
+    // The task is pushed onto the scheduler queue as soon as it is created and destroys itself once done
+    ExecuteJob(std::forward<Job>(in_task));
 }
 
 RkVoid Scheduler::WaitForQueuedTasks() noexcept
@@ -39,37 +75,93 @@ RkVoid Scheduler::WaitForQueuedTasks() noexcept
     if (!m_running.load(std::memory_order_acquire))
         return;
 
-    while (!m_job_queue.Empty())
-        std::this_thread::yield();
+    WaitUntilZero(m_pending_jobs);
 }
 
-RkVoid Scheduler::Shutdown() noexcept
+RkVoid Scheduler::WaitUntilZero(std::atomic<RkSize> const& in_counter) const noexcept
 {
-    if (!m_running.load(std::memory_order_acquire))
-        return;
+    RkSize idle_cycles {0ULL};
 
-    m_running.store(false, std::memory_order_release);
-    m_job_queue.Clear();
+    // Once there is nothing left to help with, the thread is parked until the counter is released
+    while (in_counter.load(std::memory_order_acquire) != 0ULL)
+    {
+        if (Worker::ProcessQueues(m_queues, {}) > 0ULL)
+            idle_cycles = 0ULL;
+        else
+            Worker::Idle(m_queues, {}, idle_cycles, &in_counter);
+    }
+}
+
+RkBool Scheduler::ReleaseCounter(std::atomic<RkSize>& inout_counter) noexcept
+{
+    if (inout_counter.fetch_sub(1ULL, std::memory_order_acq_rel) != 1ULL)
+        return false;
+
+    CPUParkingLot::GetInstance().Notify();
 
-    for (OldWorker& worker : m_workers)
-        worker.Detach();
+    return true;
 }
 
-std::vector<OldWorker> const& Scheduler::GetWorkers() const noexcept
+RkVoid Scheduler::WaitForTask(CPUTask<SchedulerQueue> in_task) const
 {
-    return m_workers;
+    std::atomic<RkSize> remaining {1ULL};
+    std::exception_ptr  exception {};
+
+    AwaitTask(std::move(in_task), remaining, exception);
+
+    WaitUntilZero(remaining);
+
+    if (exception)
+        std::rethrow_exception(exception);
 }
 
-RkVoid Scheduler::WorkersJob() noexcept
+RkVoid Scheduler::LogMetrics() const noexcept
 {
-    Job current_job;
+    #if defined(RUKEN_LOGGING_ENABLED)
+
+        std::ostringstream stream {};
+        stream << m_processing_unit.GetMetricsSnapshot();
 
-    while (m_running.load(std::memory_order_acquire))
+        m_logger->Info("Runtime metrics\n" + stream.str());
+
+    #endif
+}
+
+RkVoid Scheduler::EnableMetricsLogging(std::chrono::milliseconds const in_interval) noexcept
+{
+    if (!m_running.load(std::memory_order_acquire))
+        return;
+
+    // Replacing the previous thread, if any, stops and joins it
+    m_metrics_logging = std::jthread {[this, in_interval](std::stop_token const& in_stop_token)
     {
-        // Always try to dequeue jobs, the job queue will lock us if nothing is available
-        RkBool const job_validity = m_job_queue.Dequeue(current_job);
+        std::mutex                  mutex        {};
+        std::condition_variable_any notification {};
+        std::unique_lock            lock         {mutex};
+
+        // Nothing ever notifies the condition, only the stop request can interrupt the wait
+        while (!notification.wait_for(lock, in_stop_token, in_interval, [] { return false; }) && !in_stop_token.stop_requested())
+            LogMetrics();
+    }};
+}
 
-        if (job_validity)
-            current_job();
-    }
+RkVoid Scheduler::Shutdown() noexcept
+{
+    m_metrics_logging = {};
+
+    if (!m_running.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    // Remaining jobs are still consumed to release their coroutine frames, but are not executed anymore
+    WaitUntilZero(m_pending_jobs);
+}
+
+std::vector<std::unique_ptr<Worker>> const& Scheduler::GetWorkers() const noexcept
+{
+    return m_processing_unit.GetWorkers();
+}
+
+CentralProcessingUnit& Scheduler::GetProcessingUnit() noexcept
+{
+    return m_processing_unit;
 }
@@ -0,0 +1,96 @@
+#pragma once
+
+template <typename TType>
+template <typename ...TArgs, typename>
+SeqLocked<TType>::SeqLocked(TArgs... in_args) noexcept:
+    m_sequence {0ULL},
+    m_words    {}
+{
+    StoreWords(TType {std::forward<TArgs>(in_args)...});
+}
+
+template <typename TType>
+SeqLocked<TType>::SeqLocked() noexcept:
+    m_sequence {0ULL},
+    m_words    {}
+{
+    StoreWords(TType {});
+}
+
+template <typename TType>
+RkVoid SeqLocked<TType>::LoadWords(TType& out_value) const noexcept
+{
+    std::array<RkUint64, word_count> words;
+
+    for (RkSize index = 0ULL; index < word_count; ++index)
+        words[index] = m_words[index].load(std::memory_order_relaxed);
+
+    std::memcpy(&out_value, words.data(), sizeof(TType));
+}
+
+template <typename TType>
+RkVoid SeqLocked<TType>::StoreWords(TType const& in_value) noexcept
+{
+    std::array<RkUint64, word_count> words {};
+
+    std::memcpy(words.data(), &in_value, sizeof(TType));
+
+    for (RkSize index = 0ULL; index < word_count; ++index)
+        m_words[index].store(words[index], std::memory_order_relaxed);
+}
+
+template <typename TType>
+RkUint64 SeqLocked<TType>::BeginWrite() noexcept
+{
+    RkUint64 sequence {m_sequence.load(std::memory_order_relaxed)};
+
+    // Writers take the lock by making the sequence odd
+    while ((sequence & 1ULL) != 0ULL || !m_sequence.compare_exchange_weak(sequence, sequence + 1ULL, std::memory_order_relaxed))
+    {
+        atomic_queue::spin_loop_pause();
+        sequence = m_sequence.load(std::memory_order_relaxed);
+    }
+
+    // The odd sequence must be visible before any of the words is modified
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return sequence;
+}
+
+template <typename TType>
+RkVoid SeqLocked<TType>::EndWrite(RkUint64 const in_sequence) noexcept
+{
+    m_sequence.store(in_sequence + 2ULL, std::memory_order_release);
+}
+
+template <typename TType>
+TType SeqLocked<TType>::Load() const noexcept
+{
+    TType    value {};
+    RkUint64 sequence;
+
+    do
+    {
+        // Waiting for the current writer, if any
+        while (((sequence = m_sequence.load(std::memory_order_acquire)) & 1ULL) != 0ULL)
+            atomic_queue::spin_loop_pause();
+
+        LoadWords(value);
+
+        // The words must be read before the sequence is checked again
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+    } while (m_sequence.load(std::memory_order_relaxed) != sequence);
+
+    return value;
+}
+
+template <typename TType>
+RkVoid SeqLocked<TType>::Store(TType const& in_value) noexcept
+{
+    RkUint64 const sequence {BeginWrite()};
+
+    StoreWords(in_value);
+
+    EndWrite(sequence);
+}
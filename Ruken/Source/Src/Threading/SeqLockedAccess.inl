@@ -0,0 +1,77 @@
+#pragma once
+
+template<class TData>
+SeqLockedAccess<TData, EAccessMode::Read>::SeqLockedAccess(SeqLocked<TData> const& in_synchronized) noexcept:
+    m_value {in_synchronized.Load()}
+{}
+
+template <class TData>
+TData const& SeqLockedAccess<TData, EAccessMode::Read>::Get() const noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData const& SeqLockedAccess<TData, EAccessMode::Read>::operator*() const noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData const* SeqLockedAccess<TData, EAccessMode::Read>::operator->() const noexcept
+{
+    return &m_value;
+}
+
+template<class TData>
+SeqLockedAccess<TData, EAccessMode::Write>::SeqLockedAccess(SeqLocked<TData>& in_synchronized) noexcept:
+    m_synchronized {in_synchronized},
+    m_sequence     {in_synchronized.BeginWrite()},
+    m_value        {}
+{
+    // Other writers are excluded, the words cannot change anymore
+    m_synchronized.LoadWords(m_value);
+}
+
+template<class TData>
+SeqLockedAccess<TData, EAccessMode::Write>::~SeqLockedAccess() noexcept
+{
+    m_synchronized.StoreWords(m_value);
+    m_synchronized.EndWrite  (m_sequence);
+}
+
+template <class TData>
+TData& SeqLockedAccess<TData, EAccessMode::Write>::Get() noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData const& SeqLockedAccess<TData, EAccessMode::Write>::Get() const noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData& SeqLockedAccess<TData, EAccessMode::Write>::operator*() noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData const& SeqLockedAccess<TData, EAccessMode::Write>::operator*() const noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData* SeqLockedAccess<TData, EAccessMode::Write>::operator->() noexcept
+{
+    return &m_value;
+}
+
+template <class TData>
+TData const* SeqLockedAccess<TData, EAccessMode::Write>::operator->() const noexcept
+{
+    return &m_value;
+}
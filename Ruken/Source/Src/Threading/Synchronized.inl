@@ -16,13 +16,21 @@ template <typename TType>
 Synchronized<TType>::Synchronized(Synchronized const& in_copy) noexcept:
     m_mutex {},
     m_value {in_copy.m_value}
-{}
+{
+    #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+        m_statistics.store(in_copy.m_statistics.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    #endif
+}
 
 template <typename TType>
 Synchronized<TType>::Synchronized(Synchronized&& in_move) noexcept:
     m_mutex {},
     m_value {std::forward(in_move.m_value)}
-{}
+{
+    #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+        m_statistics.store(in_move.m_statistics.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    #endif
+}
 
 template <typename TType>
 TType const& Synchronized<TType>::Unsafe() const noexcept
@@ -34,4 +42,14 @@ template <typename TType>
 TType& Synchronized<TType>::Unsafe() noexcept
 {
     return m_value;
-}
\ No newline at end of file
+}
+
+template <typename TType>
+RkVoid Synchronized<TType>::SetProfilingName(std::string_view const in_name) noexcept
+{
+    #if defined(RUKEN_LOCK_PROFILING_ENABLED)
+        m_statistics.store(&LockProfiler::GetInstance().GetStatistics(in_name), std::memory_order_release);
+    #else
+        (void)in_name;
+    #endif
+}
@@ -44,9 +44,27 @@ TData const* SynchronizedAccess<TData, TMode>::operator->() const noexcept
 template<class TData>
 SynchronizedAccess<TData, EAccessMode::Read>::SynchronizedAccess(Synchronized<TData>& in_synchronized) noexcept:
     m_synchronized {in_synchronized},
+#if defined(RUKEN_LOCK_PROFILING_ENABLED)
+    m_lock         {in_synchronized.m_mutex, std::defer_lock},
+    m_statistics   {in_synchronized.m_statistics.load(std::memory_order_acquire)->read},
+    m_acquired     {LockProfiler::Acquire(m_lock, m_statistics)}
+#else
     m_lock         {in_synchronized.m_mutex}
+#endif
 {}
 
+#if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+template<class TData>
+SynchronizedAccess<TData, EAccessMode::Read>::~SynchronizedAccess() noexcept
+{
+    // Moved from accesses and manually released locks have nothing to report
+    if (m_lock.owns_lock())
+        LockProfiler::RecordRelease(m_statistics, m_acquired);
+}
+
+#endif
+
 template<class TData>
 std::shared_lock<std::shared_mutex>& SynchronizedAccess<TData, EAccessMode::Read>::GetLock() noexcept
 {
@@ -74,9 +92,27 @@ TData const* SynchronizedAccess<TData, EAccessMode::Read>::operator->() const no
 template<class TData>
 SynchronizedAccess<TData, EAccessMode::Write>::SynchronizedAccess(Synchronized<TData>& in_synchronized) noexcept:
     m_synchronized {in_synchronized},
+#if defined(RUKEN_LOCK_PROFILING_ENABLED)
+    m_lock         {in_synchronized.m_mutex, std::defer_lock},
+    m_statistics   {in_synchronized.m_statistics.load(std::memory_order_acquire)->write},
+    m_acquired     {LockProfiler::Acquire(m_lock, m_statistics)}
+#else
     m_lock         {in_synchronized.m_mutex}
+#endif
 {}
 
+#if defined(RUKEN_LOCK_PROFILING_ENABLED)
+
+template<class TData>
+SynchronizedAccess<TData, EAccessMode::Write>::~SynchronizedAccess() noexcept
+{
+    // Moved from accesses and manually released locks have nothing to report
+    if (m_lock.owns_lock())
+        LockProfiler::RecordRelease(m_statistics, m_acquired);
+}
+
+#endif
+
 template<class TData>
 std::unique_lock<std::shared_mutex>& SynchronizedAccess<TData, EAccessMode::Write>::GetLock() noexcept
 {
@@ -0,0 +1,26 @@
+#pragma once
+
+template <typename TType>
+template <typename ...TArgs, typename>
+SynchronizedRcu<TType>::SynchronizedRcu(TArgs... in_args):
+    m_write_mutex {},
+    m_current     {new TType {std::forward<TArgs>(in_args)...}}
+{}
+
+template <typename TType>
+SynchronizedRcu<TType>::SynchronizedRcu():
+    m_write_mutex {},
+    m_current     {new TType {}}
+{}
+
+template <typename TType>
+SynchronizedRcu<TType>::~SynchronizedRcu() noexcept
+{
+    delete m_current.load(std::memory_order_acquire);
+}
+
+template <typename TType>
+TType const& SynchronizedRcu<TType>::Unsafe() const noexcept
+{
+    return *m_current.load(std::memory_order_acquire);
+}
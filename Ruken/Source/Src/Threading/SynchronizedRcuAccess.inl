@@ -0,0 +1,77 @@
+#pragma once
+
+template<class TData>
+SynchronizedRcuAccess<TData, EAccessMode::Read>::SynchronizedRcuAccess(SynchronizedRcu<TData>& in_synchronized) noexcept:
+    m_guard {},
+    m_value {in_synchronized.m_current.load(std::memory_order_seq_cst)}
+{}
+
+template <class TData>
+TData const& SynchronizedRcuAccess<TData, EAccessMode::Read>::Get() const noexcept
+{
+    return *m_value;
+}
+
+template <class TData>
+TData const& SynchronizedRcuAccess<TData, EAccessMode::Read>::operator*() const noexcept
+{
+    return *m_value;
+}
+
+template <class TData>
+TData const* SynchronizedRcuAccess<TData, EAccessMode::Read>::operator->() const noexcept
+{
+    return m_value;
+}
+
+template<class TData>
+SynchronizedRcuAccess<TData, EAccessMode::Write>::SynchronizedRcuAccess(SynchronizedRcu<TData>& in_synchronized):
+    m_synchronized {in_synchronized},
+    m_lock         {in_synchronized.m_write_mutex},
+    m_copy         {std::make_unique<TData>(*in_synchronized.m_current.load(std::memory_order_relaxed))}
+{}
+
+template<class TData>
+SynchronizedRcuAccess<TData, EAccessMode::Write>::~SynchronizedRcuAccess() noexcept
+{
+    // The lock is still held, the publication of the writes is totally ordered
+    TData* const previous {m_synchronized.m_current.exchange(m_copy.release(), std::memory_order_seq_cst)};
+
+    EpochReclaimer::GetInstance().RetireObject(previous);
+}
+
+template <class TData>
+TData& SynchronizedRcuAccess<TData, EAccessMode::Write>::Get() noexcept
+{
+    return *m_copy;
+}
+
+template <class TData>
+TData const& SynchronizedRcuAccess<TData, EAccessMode::Write>::Get() const noexcept
+{
+    return *m_copy;
+}
+
+template <class TData>
+TData& SynchronizedRcuAccess<TData, EAccessMode::Write>::operator*() noexcept
+{
+    return *m_copy;
+}
+
+template <class TData>
+TData const& SynchronizedRcuAccess<TData, EAccessMode::Write>::operator*() const noexcept
+{
+    return *m_copy;
+}
+
+template <class TData>
+TData* SynchronizedRcuAccess<TData, EAccessMode::Write>::operator->() noexcept
+{
+    return m_copy.get();
+}
+
+template <class TData>
+TData const* SynchronizedRcuAccess<TData, EAccessMode::Write>::operator->() const noexcept
+{
+    return m_copy.get();
+}
@@ -22,47 +22,60 @@ RkVoid ThreadSafeLockQueue<TType>::Enqueue(TType&& in_item) noexcept
         access->push(in_item);
     }
 
+    // Synchronizing with the waiters so that none of them can miss the notification
+    { std::lock_guard<std::mutex> push_lock(m_push_mutex); }
+
     m_push_notification.notify_one();
 }
 
 template<typename TType>
 RkBool ThreadSafeLockQueue<TType>::Dequeue(TType& out_item) noexcept
 {
-    // If the queue is empty waiting for a new data to be queued
+    while (true)
     {
-        std::unique_lock<std::mutex> push_lock(m_push_mutex);
+        // If the queue is empty waiting for a new data to be queued
+        {
+            std::unique_lock<std::mutex> push_lock(m_push_mutex);
 
-        m_push_notification.wait(push_lock, [&] {
-            return !Empty() || m_unlock_all.load(std::memory_order_acquire);
-        });
-    }
+            m_push_notification.wait(push_lock, [&] {
+                return !Empty() || m_unlock_all.load(std::memory_order_acquire);
+            });
+        }
 
-    // If the wait above has been interrupted by the release() method and the queue is empty, returning here.
-    if (m_unlock_all.load(std::memory_order_acquire))
-    {
-        if (Empty())
-            m_empty_notification.notify_all();
+        // If the wait above has been interrupted by the release() method and the queue is empty, returning here.
+        if (m_unlock_all.load(std::memory_order_acquire))
+        {
+            if (Empty())
+                m_empty_notification.notify_all();
 
-        return false;
-    }
+            return false;
+        }
 
-    QueueWriteAccess access(m_queue);
+        QueueWriteAccess access(m_queue);
+
+        // Another consumer might have been woken up as well and popped the data first
+        if (access->empty())
+            continue;
 
-    // Popping a new data
-    out_item = access->front();
-    access->pop();
+        // Popping a new data
+        out_item = access->front();
+        access->pop();
 
-    // If the queue is empty, notifying the waitUntilEmpty() method
-    if (access->empty())
-        m_empty_notification.notify_all();
+        // If the queue is empty, notifying the waitUntilEmpty() method
+        if (access->empty())
+            m_empty_notification.notify_all();
 
-    return true;
+        return true;
+    }
 }
 
 template<typename TType>
 RkVoid ThreadSafeLockQueue<TType>::Release()
 {
     m_unlock_all.store(true, std::memory_order_release);
+
+    { std::lock_guard<std::mutex> push_lock(m_push_mutex); }
+
     m_push_notification.notify_all();
 }
 
@@ -47,3 +47,8 @@ RkFloat ControlClock::GetUnscaledControlTime() const noexcept
 {
     return static_cast<RkFloat>(m_corrected_control_time);
 }
+
+std::chrono::steady_clock::time_point ControlClock::GetNextControlPoint() const noexcept
+{
+    return m_last_time + std::chrono::duration_cast<InternalClock::duration>(std::chrono::duration<RkDouble>(m_frequency));
+}
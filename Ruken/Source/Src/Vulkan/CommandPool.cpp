@@ -19,7 +19,7 @@ CommandPool::CommandPool(Scheduler& in_scheduler, RkUint32 const in_queue_family
 
         data.pool = std::make_unique<VulkanCommandPool>(in_queue_family_index);
 
-        m_command_pools.emplace(worker.ID(), std::move(data));
+        m_command_pools.emplace(worker->GetId(), std::move(data));
     }
 
     // Creates a command pool for the main thread since it is not managed by the Scheduler.
@@ -9,16 +9,20 @@ USING_RUKEN_NAMESPACE
 
 #pragma warning (disable : 4100)
 
-RkVoid Material::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor)
+CPUTask<SchedulerQueue> Material::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor)
 {
     m_loading_descriptor = reinterpret_cast<MaterialLoadingDescriptor const&>(in_descriptor);
 
     // NotImplementedException
+
+    co_return;
 }
 
-RkVoid Material::Reload(ResourceManager& in_manager)
+CPUTask<SchedulerQueue> Material::Reload(ResourceManager& in_manager)
 {
     // NotImplementedException
+
+    co_return;
 }
 
 RkVoid Material::Unload(ResourceManager& in_manager) noexcept
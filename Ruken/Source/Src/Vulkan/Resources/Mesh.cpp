@@ -7,8 +7,13 @@
 
 #pragma warning (pop)
 
+#include <sstream>
+
 #include "Vulkan/Resources/Mesh.hpp"
 
+#include "Core/ExecutiveSystem/CPU/Awaitables/IO/AsyncReadFile.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/IO/OffloadBlocking.hpp"
+
 #include "Rendering/Renderer.hpp"
 
 #include "Resource/ResourceProcessingFailure.hpp"
@@ -65,10 +70,10 @@ std::optional<VulkanBuffer> Mesh::CreateIndexBuffer(VulkanDeviceAllocator const&
     return in_allocator.CreateBuffer(buffer_create_info, allocation_create_info);
 }
 
-RkVoid Mesh::UploadData(VulkanDevice           const& in_device,
-                         VulkanDeviceAllocator  const& in_allocator,
-                         std::vector<Vertex>    const& in_vertices,
-                         std::vector<RkUint32> const& in_indices) const
+CPUTask<SchedulerQueue> Mesh::UploadData(VulkanDevice           const& in_device,
+                                          VulkanDeviceAllocator  const& in_allocator,
+                                          std::vector<Vertex>    const& in_vertices,
+                                          std::vector<RkUint32> const& in_indices) const
 {
     auto const vertex_buffer_size = sizeof(Vertex)    * in_vertices.size();
     auto const index_buffer_size  = sizeof(RkUint32) * in_indices .size();
@@ -108,12 +113,12 @@ RkVoid Mesh::UploadData(VulkanDevice           const& in_device,
 
     in_device.GetTransferQueue().Submit(*command_buffer, fence.GetHandle());
 
-    fence.Wait();
+    co_await OffloadBlocking([&fence] { fence.Wait(); });
 }
 
 #pragma warning (disable : 4100)
 
-RkVoid Mesh::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor)
+CPUTask<SchedulerQueue> Mesh::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor)
 {
     m_loading_descriptor = reinterpret_cast<MeshLoadingDescriptor const&>(in_descriptor);
 
@@ -128,7 +133,16 @@ RkVoid Mesh::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const&
     std::string warning;
     std::string error;
 
-    if (!LoadObj(&attribute, &shapes, &materials, &warning, &error, m_loading_descriptor->path))
+    // The file is read by the I/O service, only the parsing runs on the worker
+    std::vector<RkByte> file;
+
+    if (!co_await AsyncReadFile(m_loading_descriptor->path, file))
+        throw ResourceProcessingFailure(EResourceProcessingFailureCode::NoSuchResource, false, "Failed to read the .obj file!");
+
+    std::istringstream stream {std::string(file.data(), file.size())};
+
+    // Materials are not used by meshes, no material reader is passed
+    if (!LoadObj(&attribute, &shapes, &materials, &warning, &error, &stream))
         throw ResourceProcessingFailure(EResourceProcessingFailureCode::CorruptedResource, "Failed to load the .obj file!");
 
     std::vector<Vertex>    vertices;
@@ -142,13 +156,13 @@ RkVoid Mesh::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const&
     if (!m_vertex_buffer || !m_index_buffer)
         throw ResourceProcessingFailure(EResourceProcessingFailureCode::OutOfMemory, "Failed to allocate the buffers!");
 
-    UploadData(device, allocator, vertices, indices);
+    co_await UploadData(device, allocator, vertices, indices);
 
     VulkanDebug::SetObjectName(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<RkUint64>(m_vertex_buffer->GetHandle()), "");
     VulkanDebug::SetObjectName(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<RkUint64>(m_index_buffer ->GetHandle()), "");
 }
 
-RkVoid Mesh::Reload(ResourceManager& in_manager)
+CPUTask<SchedulerQueue> Mesh::Reload(ResourceManager& in_manager)
 {
     auto const& device    = m_loading_descriptor->renderer.get().GetDevice();
     auto const& allocator = m_loading_descriptor->renderer.get().GetDeviceAllocator();
@@ -161,7 +175,14 @@ RkVoid Mesh::Reload(ResourceManager& in_manager)
     std::string warning;
     std::string error;
 
-    if (!LoadObj(&attribute, &shapes, &materials, &warning, &error, m_loading_descriptor->path))
+    std::vector<RkByte> file;
+
+    if (!co_await AsyncReadFile(m_loading_descriptor->path, file))
+        throw ResourceProcessingFailure(EResourceProcessingFailureCode::NoSuchResource, false, "Failed to read the .obj file!");
+
+    std::istringstream stream {std::string(file.data(), file.size())};
+
+    if (!LoadObj(&attribute, &shapes, &materials, &warning, &error, &stream))
         throw ResourceProcessingFailure(EResourceProcessingFailureCode::CorruptedResource, "Failed to load the .obj file!");
 
     std::vector<Vertex>    vertices;
@@ -175,7 +196,7 @@ RkVoid Mesh::Reload(ResourceManager& in_manager)
     if (m_index_buffer->GetSize() != sizeof(RkUint32) * indices.size())
         m_index_buffer = CreateVertexBuffer(allocator, sizeof(RkUint32) * indices.size());
 
-    UploadData(device, allocator, vertices, indices);
+    co_await UploadData(device, allocator, vertices, indices);
 }
 
 RkVoid Mesh::Unload(ResourceManager& in_manager) noexcept
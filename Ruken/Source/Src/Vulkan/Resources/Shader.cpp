@@ -15,16 +15,20 @@ USING_RUKEN_NAMESPACE
 
 #pragma warning (disable : 4100)
 
-RkVoid Shader::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor)
+CPUTask<SchedulerQueue> Shader::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor)
 {
     m_loading_descriptor = reinterpret_cast<ShaderLoadingDescriptor const&>(in_descriptor);
 
     // NotImplementedException
+
+    co_return;
 }
 
-RkVoid Shader::Reload(ResourceManager& in_manager)
+CPUTask<SchedulerQueue> Shader::Reload(ResourceManager& in_manager)
 {
     // NotImplementedException
+
+    co_return;
 }
 
 RkVoid Shader::Unload(ResourceManager& in_manager) noexcept
@@ -9,6 +9,9 @@
 
 #include "Vulkan/Resources/Texture.hpp"
 
+#include "Core/ExecutiveSystem/CPU/Awaitables/IO/AsyncReadFile.hpp"
+#include "Core/ExecutiveSystem/CPU/Awaitables/IO/OffloadBlocking.hpp"
+
 #include "Rendering/Renderer.hpp"
 
 #include "Resource/ResourceProcessingFailure.hpp"
@@ -58,10 +61,10 @@ std::optional<VulkanBuffer> Texture::CreateStagingBuffer(VulkanDeviceAllocator c
     return in_allocator.CreateBuffer(buffer_create_info, allocation_create_info);
 }
 
-RkVoid Texture::UploadData(VulkanDevice          const&    in_device,
-                            VulkanDeviceAllocator const&    in_allocator,
-                            RkVoid               const*    in_data,
-                            RkUint64             const     in_size) const
+CPUTask<SchedulerQueue> Texture::UploadData(VulkanDevice          const&    in_device,
+                                             VulkanDeviceAllocator const&    in_allocator,
+                                             RkVoid               const*    in_data,
+                                             RkUint64             const     in_size) const
 {
     auto staging_buffer = CreateStagingBuffer(in_allocator, in_size);
 
@@ -121,23 +124,29 @@ RkVoid Texture::UploadData(VulkanDevice          const&    in_device,
 
     in_device.GetTransferQueue().Submit(*command_buffer, fence.GetHandle());
 
-    fence.Wait();
+    co_await OffloadBlocking([&fence] { fence.Wait(); });
 }
 
 #pragma warning (disable : 4100)
 
-RkVoid Texture::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor)
+CPUTask<SchedulerQueue> Texture::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor)
 {
     m_loading_descriptor = reinterpret_cast<TextureLoadingDescriptor const&>(in_descriptor);
 
     auto const& device    = m_loading_descriptor->renderer.get().GetDevice();
     auto const& allocator = m_loading_descriptor->renderer.get().GetDeviceAllocator();
 
+    // The file is read by the I/O service, only the decoding runs on the worker
+    std::vector<RkByte> file;
+
+    if (!co_await AsyncReadFile(m_loading_descriptor->path, file))
+        throw ResourceProcessingFailure(EResourceProcessingFailureCode::NoSuchResource, false, "Failed to read the texture file!");
+
     auto width  = 0;
     auto height = 0;
     auto comp   = 0;
 
-    auto* pixels = stbi_load(m_loading_descriptor->path, &width, &height, &comp, STBI_rgb_alpha);
+    auto* pixels = stbi_load_from_memory(reinterpret_cast<stbi_uc const*>(file.data()), static_cast<int>(file.size()), &width, &height, &comp, STBI_rgb_alpha);
 
     if (!pixels)
         throw ResourceProcessingFailure(EResourceProcessingFailureCode::Other);
@@ -147,21 +156,26 @@ RkVoid Texture::Load(ResourceManager& in_manager, ResourceLoadingDescriptor cons
     if (!m_image)
         throw ResourceProcessingFailure(EResourceProcessingFailureCode::Other);
 
-    UploadData(device, allocator, pixels, width * height * comp);
+    co_await UploadData(device, allocator, pixels, width * height * comp);
 }
 
-RkVoid Texture::Reload(ResourceManager& in_manager)
+CPUTask<SchedulerQueue> Texture::Reload(ResourceManager& in_manager)
 {
     auto const& device    = m_loading_descriptor->renderer.get().GetDevice();
     auto const& allocator = m_loading_descriptor->renderer.get().GetDeviceAllocator();
 
+    std::vector<RkByte> file;
+
+    if (!co_await AsyncReadFile(m_loading_descriptor->path, file))
+        throw ResourceProcessingFailure(EResourceProcessingFailureCode::NoSuchResource, false, "Failed to read the texture file!");
+
     auto width  = 0;
     auto height = 0;
     auto comp   = 0;
 
-    auto* pixels = stbi_load(m_loading_descriptor->path, &width, &height, &comp, STBI_rgb_alpha);
+    auto* pixels = stbi_load_from_memory(reinterpret_cast<stbi_uc const*>(file.data()), static_cast<int>(file.size()), &width, &height, &comp, STBI_rgb_alpha);
 
-    UploadData(device, allocator, pixels, width * height * comp);
+    co_await UploadData(device, allocator, pixels, width * height * comp);
 }
 
 RkVoid Texture::Unload(ResourceManager& in_manager) noexcept